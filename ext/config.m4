@@ -628,6 +628,10 @@ if test "$PHP_PHALCON" = "yes"; then
 	phalcon/13__closure.zep.c
 	phalcon/14__closure.zep.c phalcon/annotations/scanner.c
 	phalcon/annotations/parser.c
+	phalcon/assets/filters/cssminifier.c
+	phalcon/assets/filters/jsminifier.c
+	phalcon/html/escaper/utf8.c
+	phalcon/image/adapter/kernels.c
 	phalcon/mvc/model/orm.c
 	phalcon/mvc/model/query/scanner.c
 	phalcon/mvc/model/query/parser.c
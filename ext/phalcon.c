@@ -1344,6 +1344,8 @@ static void php_zephir_init_globals(zend_phalcon_globals *phalcon_globals)
 
 
 	phalcon_globals->orm.parser_cache = NULL;
+	phalcon_globals->orm.phql_cache_memory = 8388608;
+	phalcon_globals->orm.phql_cache_size = 0;
 	phalcon_globals->orm.resultset_prefetch_records = ZSTR_VAL(zend_string_init(ZEND_STRL("0"), 0));
 	phalcon_globals->orm.unique_cache_id = 3;
 
@@ -1358,7 +1360,12 @@ static void php_zephir_init_globals(zend_phalcon_globals *phalcon_globals)
  */
 static void php_zephir_init_module_globals(zend_phalcon_globals *phalcon_globals)
 {
-	
+	phalcon_globals->orm.phql_cache = NULL;
+	phalcon_globals->orm.phql_cache_evictions = 0;
+	phalcon_globals->orm.phql_cache_hits = 0;
+	phalcon_globals->orm.phql_cache_misses = 0;
+	phalcon_globals->orm.phql_cache_used = 0;
+
 }
 
 static PHP_RINIT_FUNCTION(phalcon)
@@ -1412,6 +1419,7 @@ static PHP_GINIT_FUNCTION(phalcon)
 static PHP_GSHUTDOWN_FUNCTION(phalcon)
 {
 	
+	phalcon_orm_phql_cache_destroy(phalcon_globals);
 }
 
 
@@ -0,0 +1,204 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * The CSS minifier is a single pass over the input: comments are dropped,
+ * runs of whitespace are collapsed to a single space which is removed next
+ * to punctuators, strings and escapes are copied verbatim and the last
+ * semicolon of a block is removed. The running time is linear and, besides
+ * the output buffer, the memory used is constant.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "kernel/main.h"
+#include "kernel/exception.h"
+
+#include <zend_smart_str.h>
+
+#include "phalcon/assets/filters/cssminifier.h"
+
+static int cssmin_is_space(unsigned char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+/**
+ * Characters which never need whitespace before them
+ */
+static int cssmin_is_closing(unsigned char c)
+{
+	switch (c) {
+		case '{':
+		case '}':
+		case ';':
+		case ',':
+		case '>':
+		case ')':
+			return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Characters which never need whitespace after them. A space before a colon
+ * is kept, since "a :hover" and "a:hover" are different selectors
+ */
+static int cssmin_is_opening(unsigned char c)
+{
+	switch (c) {
+		case '\0':
+		case '{':
+		case '}':
+		case ';':
+		case ',':
+		case '>':
+		case ':':
+		case '(':
+			return 1;
+	}
+
+	return 0;
+}
+
+int phalcon_cssmin(zval *return_value, zval *style)
+{
+	smart_str minified = {0};
+	const unsigned char *cursor, *end;
+	const char *error = NULL;
+	unsigned char c, quote, last = '\0';
+	int space = 0;
+
+	if (Z_TYPE_P(style) != IS_STRING || !Z_STRLEN_P(style)) {
+		RETVAL_EMPTY_STRING();
+		return SUCCESS;
+	}
+
+	cursor = (const unsigned char *) Z_STRVAL_P(style);
+	end = cursor + Z_STRLEN_P(style);
+
+	/* Skip the UTF-8 byte order mark */
+	if (Z_STRLEN_P(style) >= 3 && !memcmp(cursor, "\xEF\xBB\xBF", 3)) {
+		cursor += 3;
+	}
+
+	while (cursor < end) {
+		c = *cursor++;
+
+		/* Comments separate tokens the same way whitespace does */
+		if (c == '/' && cursor < end && *cursor == '*') {
+			cursor++;
+			for (;;) {
+				if (cursor + 1 >= end) {
+					error = "Unterminated comment.";
+					break;
+				}
+
+				if (cursor[0] == '*' && cursor[1] == '/') {
+					cursor += 2;
+					break;
+				}
+
+				cursor++;
+			}
+
+			if (error) {
+				break;
+			}
+
+			space = 1;
+			continue;
+		}
+
+		if (cssmin_is_space(c)) {
+			space = 1;
+			continue;
+		}
+
+		if (cssmin_is_closing(c)) {
+			space = 0;
+
+			/* The last declaration of a block does not need a semicolon */
+			if (c == '}' && last == ';') {
+				ZSTR_LEN(minified.s)--;
+			}
+
+			smart_str_appendc(&minified, (char) c);
+			last = c;
+			continue;
+		}
+
+		if (space) {
+			if (!cssmin_is_opening(last)) {
+				smart_str_appendc(&minified, ' ');
+			}
+
+			space = 0;
+		}
+
+		smart_str_appendc(&minified, (char) c);
+		last = c;
+
+		if (c == '\\') {
+			if (cursor < end) {
+				smart_str_appendc(&minified, (char) *cursor++);
+			}
+
+			continue;
+		}
+
+		if (c == '"' || c == '\'') {
+			quote = c;
+			for (;;) {
+				if (cursor >= end) {
+					error = "Unterminated string literal.";
+					break;
+				}
+
+				c = *cursor++;
+				smart_str_appendc(&minified, (char) c);
+
+				if (c == '\\') {
+					if (cursor < end) {
+						smart_str_appendc(&minified, (char) *cursor++);
+					}
+				} else if (c == quote) {
+					break;
+				}
+			}
+
+			if (error) {
+				break;
+			}
+		}
+	}
+
+	if (error) {
+		smart_str_free(&minified);
+		ZEPHIR_THROW_EXCEPTION_STRW(phalcon_assets_exception_ce, error);
+		RETVAL_EMPTY_STRING();
+		return FAILURE;
+	}
+
+	smart_str_0(&minified);
+
+	if (minified.s) {
+		RETVAL_STR(minified.s);
+	} else {
+		RETVAL_EMPTY_STRING();
+	}
+
+	return SUCCESS;
+}
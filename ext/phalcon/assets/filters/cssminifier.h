@@ -0,0 +1,19 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_ASSETS_FILTERS_CSSMINIFIER_H
+#define PHALCON_ASSETS_FILTERS_CSSMINIFIER_H
+
+#include <Zend/zend.h>
+
+/* Minifies a CSS source, throws Phalcon\Assets\Exception on errors */
+int phalcon_cssmin(zval *return_value, zval *style);
+
+#endif /* PHALCON_ASSETS_FILTERS_CSSMINIFIER_H */
@@ -0,0 +1,498 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Based on jsmin.c by Douglas Crockford (2002-12-04), the JavaScript
+ * minifier is a single pass over the input with one character of
+ * lookahead: the running time is linear and, besides the output buffer,
+ * the memory used is constant.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "kernel/main.h"
+#include "kernel/exception.h"
+
+#include <zend_smart_str.h>
+
+#include "phalcon/assets/filters/jsminifier.h"
+
+#define JSMIN_EOF -1
+#define JSMIN_MAX_TEMPLATE_DEPTH 32
+
+typedef struct _jsmin_parser {
+	const unsigned char *script;
+	size_t length;
+	size_t position;
+	smart_str *minified;
+	int the_a;
+	int the_b;
+	int the_lookahead;
+	int the_x;
+	int the_y;
+	const char *error;
+} jsmin_parser;
+
+/**
+ * Returns true if the character is a letter, digit, underscore, dollar sign,
+ * hash (private class members), backslash or non-ASCII character
+ */
+static int jsmin_is_alphanum(int c)
+{
+	return ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+		(c >= 'A' && c <= 'Z') || c == '_' || c == '$' || c == '#' || c == '\\' ||
+		c > 126);
+}
+
+static void jsmin_put(jsmin_parser *parser, int c)
+{
+	/* The algorithm starts as if a newline preceded the script */
+	if (c == '\n' && parser->minified->s == NULL) {
+		return;
+	}
+
+	smart_str_appendc(parser->minified, (char) c);
+}
+
+/**
+ * Returns the next character from the input. Watches out for lookahead. If
+ * the character is a control character, translates it to a space or
+ * linefeed
+ */
+static int jsmin_get(jsmin_parser *parser)
+{
+	int c = parser->the_lookahead;
+
+	parser->the_lookahead = JSMIN_EOF;
+
+	if (c == JSMIN_EOF) {
+		if (parser->error || parser->position >= parser->length) {
+			return JSMIN_EOF;
+		}
+
+		c = parser->script[parser->position++];
+	}
+
+	if (c >= ' ' || c == '\n' || c == JSMIN_EOF) {
+		return c;
+	}
+
+	if (c == '\r') {
+		return '\n';
+	}
+
+	return ' ';
+}
+
+/**
+ * Gets the next character without advancing
+ */
+static int jsmin_peek(jsmin_parser *parser)
+{
+	parser->the_lookahead = jsmin_get(parser);
+
+	return parser->the_lookahead;
+}
+
+/**
+ * Gets the next character, excluding comments. A multi-line comment is
+ * replaced by a single space
+ */
+static int jsmin_next(jsmin_parser *parser)
+{
+	int c = jsmin_get(parser);
+
+	if (c == '/') {
+		switch (jsmin_peek(parser)) {
+			case '/':
+				for (;;) {
+					c = jsmin_get(parser);
+					if (c <= '\n') {
+						break;
+					}
+				}
+				break;
+
+			case '*':
+				jsmin_get(parser);
+				while (c != ' ') {
+					switch (jsmin_get(parser)) {
+						case '*':
+							if (jsmin_peek(parser) == '/') {
+								jsmin_get(parser);
+								c = ' ';
+							}
+							break;
+
+						case JSMIN_EOF:
+							parser->error = "Unterminated comment.";
+							return JSMIN_EOF;
+					}
+				}
+				break;
+		}
+	}
+
+	parser->the_y = parser->the_x;
+	parser->the_x = c;
+
+	return c;
+}
+
+/**
+ * Returns the next raw character from the input, template literals are
+ * copied byte by byte
+ */
+static int jsmin_get_raw(jsmin_parser *parser)
+{
+	int c = parser->the_lookahead;
+
+	parser->the_lookahead = JSMIN_EOF;
+
+	if (c != JSMIN_EOF) {
+		return c;
+	}
+
+	if (parser->error || parser->position >= parser->length) {
+		return JSMIN_EOF;
+	}
+
+	return parser->script[parser->position++];
+}
+
+/**
+ * Copies a template literal verbatim, without its closing backtick. The
+ * substitutions may contain strings and other template literals
+ */
+static void jsmin_template(jsmin_parser *parser, int depth)
+{
+	int c, quote, braces;
+
+	if (depth > JSMIN_MAX_TEMPLATE_DEPTH) {
+		parser->error = "Template literal nesting too deep.";
+		return;
+	}
+
+	jsmin_put(parser, '`');
+
+	for (;;) {
+		c = jsmin_get_raw(parser);
+		if (c == JSMIN_EOF) {
+			parser->error = "Unterminated template literal.";
+			return;
+		}
+
+		if (c == '`') {
+			return;
+		}
+
+		jsmin_put(parser, c);
+
+		if (c == '\\') {
+			c = jsmin_get_raw(parser);
+			if (c == JSMIN_EOF) {
+				parser->error = "Unterminated template literal.";
+				return;
+			}
+
+			jsmin_put(parser, c);
+			continue;
+		}
+
+		if (c != '$' || parser->position >= parser->length || parser->script[parser->position] != '{') {
+			continue;
+		}
+
+		jsmin_put(parser, jsmin_get_raw(parser));
+
+		braces = 1;
+		while (braces > 0) {
+			c = jsmin_get_raw(parser);
+			if (c == JSMIN_EOF) {
+				parser->error = "Unterminated template literal.";
+				return;
+			}
+
+			if (c == '`') {
+				jsmin_template(parser, depth + 1);
+				if (parser->error) {
+					return;
+				}
+
+				jsmin_put(parser, '`');
+				continue;
+			}
+
+			jsmin_put(parser, c);
+
+			if (c == '{') {
+				braces++;
+			} else if (c == '}') {
+				braces--;
+			} else if (c == '\'' || c == '"') {
+				quote = c;
+				do {
+					c = jsmin_get_raw(parser);
+					if (c == JSMIN_EOF) {
+						parser->error = "Unterminated string literal.";
+						return;
+					}
+
+					jsmin_put(parser, c);
+					if (c == '\\') {
+						c = jsmin_get_raw(parser);
+						if (c == JSMIN_EOF) {
+							parser->error = "Unterminated string literal.";
+							return;
+						}
+
+						jsmin_put(parser, c);
+						c = 0;
+					}
+				} while (c != quote);
+			}
+		}
+	}
+}
+
+/**
+ * Does something, what is done is determined by the argument:
+ *
+ * 1 Output A. Copy B to A. Get the next B.
+ * 2 Copy B to A. Get the next B. (Delete A).
+ * 3 Get the next B. (Delete B).
+ *
+ * Treats strings as a single character and recognizes regular expressions
+ * if they are preceded by an operator or a punctuator
+ */
+static void jsmin_action(jsmin_parser *parser, int d)
+{
+	switch (d) {
+		case 1:
+			jsmin_put(parser, parser->the_a);
+			if (
+				(parser->the_y == '\n' || parser->the_y == ' ') &&
+				(parser->the_a == '+' || parser->the_a == '-' || parser->the_a == '*' || parser->the_a == '/') &&
+				(parser->the_b == '+' || parser->the_b == '-' || parser->the_b == '*' || parser->the_b == '/')
+			) {
+				jsmin_put(parser, parser->the_y);
+			}
+			/* no break */
+
+		case 2:
+			parser->the_a = parser->the_b;
+			if (parser->the_a == '`') {
+				jsmin_template(parser, 0);
+				if (parser->error) {
+					return;
+				}
+			} else if (parser->the_a == '\'' || parser->the_a == '"') {
+				for (;;) {
+					jsmin_put(parser, parser->the_a);
+					parser->the_a = jsmin_get(parser);
+					if (parser->the_a == parser->the_b) {
+						break;
+					}
+
+					if (parser->the_a == '\\') {
+						jsmin_put(parser, parser->the_a);
+						parser->the_a = jsmin_get(parser);
+					}
+
+					if (parser->the_a == JSMIN_EOF) {
+						parser->error = "Unterminated string literal.";
+						return;
+					}
+				}
+			}
+			/* no break */
+
+		case 3:
+			parser->the_b = jsmin_next(parser);
+			if (parser->error) {
+				return;
+			}
+
+			if (
+				parser->the_b == '/' && (
+					parser->the_a == '(' || parser->the_a == ',' || parser->the_a == '=' ||
+					parser->the_a == ':' || parser->the_a == '[' || parser->the_a == '!' ||
+					parser->the_a == '&' || parser->the_a == '|' || parser->the_a == '?' ||
+					parser->the_a == '+' || parser->the_a == '-' || parser->the_a == '~' ||
+					parser->the_a == '*' || parser->the_a == '/' || parser->the_a == '{' ||
+					parser->the_a == '}' || parser->the_a == ';' || parser->the_a == '<' ||
+				parser->the_a == '>' || parser->the_a == '\n'
+				)
+			) {
+				jsmin_put(parser, parser->the_a);
+				if (parser->the_a == '/' || parser->the_a == '*') {
+					jsmin_put(parser, ' ');
+				}
+
+				jsmin_put(parser, parser->the_b);
+				for (;;) {
+					parser->the_a = jsmin_get(parser);
+					if (parser->the_a == '[') {
+						for (;;) {
+							jsmin_put(parser, parser->the_a);
+							parser->the_a = jsmin_get(parser);
+							if (parser->the_a == ']') {
+								break;
+							}
+
+							if (parser->the_a == '\\') {
+								jsmin_put(parser, parser->the_a);
+								parser->the_a = jsmin_get(parser);
+							}
+
+							if (parser->the_a == JSMIN_EOF) {
+								parser->error = "Unterminated set in Regular Expression literal.";
+								return;
+							}
+						}
+					} else if (parser->the_a == '/') {
+						switch (jsmin_peek(parser)) {
+							case '/':
+							case '*':
+								parser->error = "Unterminated set in Regular Expression literal.";
+								return;
+						}
+						break;
+					} else if (parser->the_a == '\\') {
+						jsmin_put(parser, parser->the_a);
+						parser->the_a = jsmin_get(parser);
+					}
+
+					if (parser->the_a == JSMIN_EOF) {
+						parser->error = "Unterminated Regular Expression literal.";
+						return;
+					}
+
+					jsmin_put(parser, parser->the_a);
+				}
+
+				parser->the_b = jsmin_next(parser);
+			}
+	}
+}
+
+/**
+ * Copies the input to the output, deleting the characters which are
+ * insignificant to JavaScript. Comments will be removed. Tabs will be
+ * replaced with spaces. Carriage returns will be replaced with linefeeds.
+ * Most spaces and linefeeds will be removed
+ */
+int phalcon_jsmin(zval *return_value, zval *script)
+{
+	smart_str minified = {0};
+	jsmin_parser parser;
+
+	if (Z_TYPE_P(script) != IS_STRING || !Z_STRLEN_P(script)) {
+		RETVAL_EMPTY_STRING();
+		return SUCCESS;
+	}
+
+	parser.script = (const unsigned char *) Z_STRVAL_P(script);
+	parser.length = Z_STRLEN_P(script);
+	parser.position = 0;
+	parser.minified = &minified;
+	parser.the_lookahead = JSMIN_EOF;
+	parser.the_x = JSMIN_EOF;
+	parser.the_y = JSMIN_EOF;
+	parser.error = NULL;
+
+	/* Skip the UTF-8 byte order mark */
+	if (parser.length >= 3 && !memcmp(parser.script, "\xEF\xBB\xBF", 3)) {
+		parser.position = 3;
+	}
+
+	parser.the_a = '\n';
+	jsmin_action(&parser, 3);
+
+	while (parser.the_a != JSMIN_EOF && !parser.error) {
+		switch (parser.the_a) {
+			case ' ':
+				jsmin_action(&parser, jsmin_is_alphanum(parser.the_b) ? 1 : 2);
+				break;
+
+			case '\n':
+				switch (parser.the_b) {
+					case '{':
+					case '[':
+					case '(':
+					case '+':
+					case '-':
+					case '!':
+					case '~':
+						jsmin_action(&parser, 1);
+						break;
+
+					case ' ':
+						jsmin_action(&parser, 3);
+						break;
+
+					default:
+						jsmin_action(&parser, jsmin_is_alphanum(parser.the_b) ? 1 : 2);
+				}
+				break;
+
+			default:
+				switch (parser.the_b) {
+					case ' ':
+						jsmin_action(&parser, jsmin_is_alphanum(parser.the_a) ? 1 : 3);
+						break;
+
+					case '\n':
+						switch (parser.the_a) {
+							case '}':
+							case ']':
+							case ')':
+							case '+':
+							case '-':
+							case '"':
+							case '\'':
+							case '`':
+							case '/':
+								jsmin_action(&parser, 1);
+								break;
+
+							default:
+								jsmin_action(&parser, jsmin_is_alphanum(parser.the_a) ? 1 : 3);
+						}
+						break;
+
+					default:
+						jsmin_action(&parser, 1);
+						break;
+				}
+		}
+	}
+
+	if (parser.error) {
+		smart_str_free(&minified);
+		ZEPHIR_THROW_EXCEPTION_STRW(phalcon_assets_exception_ce, parser.error);
+		RETVAL_EMPTY_STRING();
+		return FAILURE;
+	}
+
+	smart_str_0(&minified);
+
+	if (minified.s) {
+		RETVAL_STR(minified.s);
+	} else {
+		RETVAL_EMPTY_STRING();
+	}
+
+	return SUCCESS;
+}
@@ -0,0 +1,19 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_ASSETS_FILTERS_JSMINIFIER_H
+#define PHALCON_ASSETS_FILTERS_JSMINIFIER_H
+
+#include <Zend/zend.h>
+
+/* Minifies a JavaScript source, throws Phalcon\Assets\Exception on errors */
+int phalcon_jsmin(zval *return_value, zval *script);
+
+#endif /* PHALCON_ASSETS_FILTERS_JSMINIFIER_H */
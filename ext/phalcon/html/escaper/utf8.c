@@ -0,0 +1,478 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * The escapers work on the UTF-8 input directly: runs of characters which
+ * are copied verbatim are found 16 bytes at a time and appended in bulk,
+ * multibyte sequences are decoded and validated in place and the input is
+ * returned as it is when nothing needs escaping. Anything they cannot
+ * reproduce exactly (invalid UTF-8, other encodings, NUL characters) makes
+ * them return null, so the caller falls back to the generic path.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "kernel/main.h"
+
+#include <ext/standard/html.h>
+#include <zend_smart_str.h>
+
+#include "phalcon/html/escaper/utf8.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PHALCON_ESCAPE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#define PHALCON_ESCAPE_CSS  0
+#define PHALCON_ESCAPE_JS   1
+#define PHALCON_ESCAPE_HTML 2
+#define PHALCON_ESCAPE_URL  3
+
+static zend_always_inline int phalcon_escape_is_alnum(unsigned char c)
+{
+	return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+}
+
+/**
+ * Whether an ASCII byte is copied verbatim in a context. Bytes above 0x7F
+ * are never safe here, HTML copies valid sequences in the main loop
+ */
+static zend_always_inline int phalcon_escape_is_safe(unsigned char c, int context)
+{
+	if (phalcon_escape_is_alnum(c)) {
+		return 1;
+	}
+
+	switch (context) {
+		case PHALCON_ESCAPE_JS:
+			switch (c) {
+				case ' ':
+				case '/':
+				case '*':
+				case '+':
+				case '-':
+				case '\t':
+				case '\n':
+				case '^':
+				case '$':
+				case '!':
+				case '?':
+				case '\\':
+				case '#':
+				case '}':
+				case '{':
+				case ')':
+				case '(':
+				case ']':
+				case '[':
+				case '.':
+				case ',':
+				case ':':
+				case ';':
+				case '_':
+				case '|':
+					return 1;
+			}
+
+			return 0;
+
+		case PHALCON_ESCAPE_HTML:
+			return c < 0x80 && c != '&' && c != '<' && c != '>' && c != '"' && c != '\'';
+
+		case PHALCON_ESCAPE_URL:
+			return c == '-' || c == '.' || c == '_' || c == '~';
+	}
+
+	return 0;
+}
+
+#ifdef PHALCON_ESCAPE_SSE2
+/**
+ * Bytes between low and high. Bytes above 0x7F compare as negative and are
+ * never in range
+ */
+static zend_always_inline __m128i phalcon_escape_range(__m128i block, char low, char high)
+{
+	return _mm_and_si128(
+		_mm_cmpgt_epi8(block, _mm_set1_epi8(low - 1)),
+		_mm_cmplt_epi8(block, _mm_set1_epi8(high + 1))
+	);
+}
+
+static zend_always_inline __m128i phalcon_escape_any(__m128i block, const char *characters)
+{
+	__m128i mask = _mm_setzero_si128();
+
+	while (*characters) {
+		mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8(*characters++)));
+	}
+
+	return mask;
+}
+
+/**
+ * Whether the 16 bytes of a block are copied verbatim. The blocks holding a
+ * byte which is not are left to the scalar loop
+ */
+static zend_always_inline int phalcon_escape_block_is_safe(__m128i block, int context)
+{
+	__m128i safe;
+
+	switch (context) {
+		case PHALCON_ESCAPE_JS:
+			/* Printable ASCII, except the characters out of the whitelist */
+			safe = _mm_andnot_si128(
+				phalcon_escape_any(block, "\"%&'<=>@`~"),
+				phalcon_escape_range(block, 0x20, 0x7E)
+			);
+			break;
+
+		case PHALCON_ESCAPE_HTML:
+			safe = _mm_andnot_si128(
+				phalcon_escape_any(block, "&<>\"'"),
+				_mm_cmpgt_epi8(block, _mm_set1_epi8(-1))
+			);
+			break;
+
+		case PHALCON_ESCAPE_URL:
+			safe = _mm_or_si128(
+				phalcon_escape_any(block, "-._~"),
+				_mm_or_si128(
+					phalcon_escape_range(block, '0', '9'),
+					_mm_or_si128(
+						phalcon_escape_range(block, 'A', 'Z'),
+						phalcon_escape_range(block, 'a', 'z')
+					)
+				)
+			);
+			break;
+
+		default:
+			safe = _mm_or_si128(
+				phalcon_escape_range(block, '0', '9'),
+				_mm_or_si128(
+					phalcon_escape_range(block, 'A', 'Z'),
+					phalcon_escape_range(block, 'a', 'z')
+				)
+			);
+			break;
+	}
+
+	return _mm_movemask_epi8(safe) == 0xFFFF;
+}
+#endif
+
+/**
+ * Returns the length of the run of safe bytes at the start of the input
+ */
+static zend_always_inline size_t phalcon_escape_span(const unsigned char *input, size_t length, int context)
+{
+	size_t position = 0;
+
+#ifdef PHALCON_ESCAPE_SSE2
+	while (position + 16 <= length) {
+		if (!phalcon_escape_block_is_safe(_mm_loadu_si128((const __m128i *) (input + position)), context)) {
+			break;
+		}
+
+		position += 16;
+	}
+#endif
+
+	while (position < length && phalcon_escape_is_safe(input[position], context)) {
+		position++;
+	}
+
+	return position;
+}
+
+/**
+ * Decodes a well formed UTF-8 sequence as mbstring validates it: no
+ * overlong forms, no surrogates and nothing above U+10FFFF. Returns the
+ * length of the sequence, 0 when it is not valid
+ */
+static size_t phalcon_escape_utf8_decode(const unsigned char *input, size_t length, unsigned int *codepoint)
+{
+	unsigned char c = input[0], low = 0x80, high = 0xBF;
+	size_t size, i;
+
+	if (c < 0x80) {
+		*codepoint = c;
+		return 1;
+	}
+
+	if (c >= 0xC2 && c <= 0xDF) {
+		size = 2;
+		*codepoint = c & 0x1F;
+	} else if (c >= 0xE0 && c <= 0xEF) {
+		size = 3;
+		*codepoint = c & 0x0F;
+
+		if (c == 0xE0) {
+			low = 0xA0;
+		} else if (c == 0xED) {
+			high = 0x9F;
+		}
+	} else if (c >= 0xF0 && c <= 0xF4) {
+		size = 4;
+		*codepoint = c & 0x07;
+
+		if (c == 0xF0) {
+			low = 0x90;
+		} else if (c == 0xF4) {
+			high = 0x8F;
+		}
+	} else {
+		return 0;
+	}
+
+	if (size > length || input[1] < low || input[1] > high) {
+		return 0;
+	}
+
+	for (i = 1; i < size; i++) {
+		if ((input[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+
+		*codepoint = (*codepoint << 6) | (input[i] & 0x3F);
+	}
+
+	return size;
+}
+
+static void phalcon_escape_append_hex(smart_str *escaped, unsigned int value)
+{
+	static const char digits[] = "0123456789abcdef";
+	char buffer[8], *start = buffer + sizeof(buffer);
+
+	do {
+		*--start = digits[value & 0x0F];
+		value >>= 4;
+	} while (value);
+
+	smart_str_appendl(escaped, start, buffer + sizeof(buffer) - start);
+}
+
+/**
+ * Returns the entity of an HTML special character, or NULL when the flags
+ * leave it as it is
+ */
+static const char *phalcon_escape_html_entity(unsigned char c, zend_long flags, size_t *size)
+{
+	switch (c) {
+		case '&':
+			*size = sizeof("&amp;") - 1;
+			return "&amp;";
+
+		case '<':
+			*size = sizeof("&lt;") - 1;
+			return "&lt;";
+
+		case '>':
+			*size = sizeof("&gt;") - 1;
+			return "&gt;";
+
+		case '"':
+			if (flags & ENT_HTML_QUOTE_DOUBLE) {
+				*size = sizeof("&quot;") - 1;
+				return "&quot;";
+			}
+			break;
+
+		case '\'':
+			if (flags & ENT_HTML_QUOTE_SINGLE) {
+				*size = sizeof("&#039;") - 1;
+				return (flags & ENT_HTML_DOC_TYPE_MASK) == ENT_HTML_DOC_HTML401 ? "&#039;" : "&apos;";
+			}
+			break;
+	}
+
+	return NULL;
+}
+
+static void phalcon_escape_utf8(zval *return_value, zval *input, int context, zend_long flags)
+{
+	const unsigned char *source;
+	const char *entity = NULL;
+	smart_str escaped = {0};
+	size_t length, position = 0, pending = 0, size;
+	unsigned int codepoint;
+	int changed = 0;
+
+	if (Z_TYPE_P(input) != IS_STRING) {
+		RETURN_NULL();
+	}
+
+	source = (const unsigned char *) Z_STRVAL_P(input);
+	length = Z_STRLEN_P(input);
+
+	/**
+	 * The generic path returns false for empty CSS and JS strings
+	 */
+	if (length == 0 && (context == PHALCON_ESCAPE_CSS || context == PHALCON_ESCAPE_JS)) {
+		RETURN_NULL();
+	}
+
+	while (1) {
+		position += phalcon_escape_span(source + position, length - position, context);
+
+		if (position >= length) {
+			break;
+		}
+
+		if (context == PHALCON_ESCAPE_URL) {
+			size = 1;
+			codepoint = source[position];
+		} else {
+			size = phalcon_escape_utf8_decode(source + position, length - position, &codepoint);
+
+			if (size == 0) {
+				smart_str_free(&escaped);
+				RETURN_NULL();
+			}
+		}
+
+		switch (context) {
+			case PHALCON_ESCAPE_HTML:
+				/**
+				 * Multibyte sequences are kept as they are
+				 */
+				if (size > 1) {
+					position += size;
+					continue;
+				}
+
+				entity = phalcon_escape_html_entity(source[position], flags, &size);
+
+				if (entity == NULL) {
+					position++;
+					continue;
+				}
+
+				break;
+
+			case PHALCON_ESCAPE_URL:
+				break;
+
+			default:
+				/**
+				 * CSS 2.1 section 4.1.3: "It is undefined in CSS 2.1 what
+				 * happens if a style sheet does contain a character with
+				 * Unicode codepoint zero."
+				 */
+				if (codepoint == 0) {
+					smart_str_free(&escaped);
+					RETURN_NULL();
+				}
+				break;
+		}
+
+		if (!changed) {
+			smart_str_alloc(&escaped, length + (length >> 2) + 16, 0);
+			changed = 1;
+		}
+
+		smart_str_appendl(&escaped, (const char *) source + pending, position - pending);
+
+		switch (context) {
+			case PHALCON_ESCAPE_HTML:
+				smart_str_appendl(&escaped, entity, size);
+				size = 1;
+				break;
+
+			case PHALCON_ESCAPE_URL:
+				smart_str_appendc(&escaped, '%');
+				smart_str_appendc(&escaped, "0123456789ABCDEF"[codepoint >> 4]);
+				smart_str_appendc(&escaped, "0123456789ABCDEF"[codepoint & 0x0F]);
+				break;
+
+			case PHALCON_ESCAPE_JS:
+				smart_str_appendl(&escaped, "\\x", 2);
+				phalcon_escape_append_hex(&escaped, codepoint);
+				break;
+
+			default:
+				smart_str_appendc(&escaped, '\\');
+				phalcon_escape_append_hex(&escaped, codepoint);
+				smart_str_appendc(&escaped, ' ');
+				break;
+		}
+
+		position += size;
+		pending = position;
+	}
+
+	/**
+	 * Nothing was escaped, the input is returned as it is
+	 */
+	if (!changed) {
+		ZVAL_COPY(return_value, input);
+		return;
+	}
+
+	smart_str_appendl(&escaped, (const char *) source + pending, length - pending);
+	smart_str_0(&escaped);
+
+	RETURN_STR(escaped.s);
+}
+
+/**
+ * Escapes non-alphanumeric characters to \HH+space
+ */
+void phalcon_escape_css_utf8(zval *return_value, zval *input)
+{
+	phalcon_escape_utf8(return_value, input, PHALCON_ESCAPE_CSS, 0);
+}
+
+/**
+ * Escapes non-alphanumeric characters to \xHH+
+ */
+void phalcon_escape_js_utf8(zval *return_value, zval *input)
+{
+	phalcon_escape_utf8(return_value, input, PHALCON_ESCAPE_JS, 0);
+}
+
+/**
+ * Escapes the HTML special characters as htmlspecialchars() does. Other
+ * encodings, disabled double encoding and the substitution of disallowed
+ * characters are left to htmlspecialchars()
+ */
+void phalcon_escape_html_utf8(zval *return_value, zval *input, zval *flags, zval *encoding, zval *double_encode)
+{
+	zend_long options = zval_get_long(flags);
+
+	if (Z_TYPE_P(encoding) != IS_STRING || !zend_is_true(double_encode)) {
+		RETURN_NULL();
+	}
+
+	if (zend_binary_strcasecmp(Z_STRVAL_P(encoding), Z_STRLEN_P(encoding), "utf-8", sizeof("utf-8") - 1) != 0) {
+		RETURN_NULL();
+	}
+
+	if (options & ENT_HTML_SUBSTITUTE_DISALLOWED_CHARS) {
+		RETURN_NULL();
+	}
+
+	phalcon_escape_utf8(return_value, input, PHALCON_ESCAPE_HTML, options);
+}
+
+/**
+ * Escapes everything but the unreserved characters of RFC 3986 to %HH
+ */
+void phalcon_escape_url(zval *return_value, zval *input)
+{
+	phalcon_escape_utf8(return_value, input, PHALCON_ESCAPE_URL, 0);
+}
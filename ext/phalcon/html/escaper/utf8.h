@@ -0,0 +1,24 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_HTML_ESCAPER_UTF8_H
+#define PHALCON_HTML_ESCAPER_UTF8_H
+
+#include <Zend/zend.h>
+
+/* Escapes UTF-8 input, null when it must be handled by the generic path */
+void phalcon_escape_css_utf8(zval *return_value, zval *input);
+void phalcon_escape_js_utf8(zval *return_value, zval *input);
+void phalcon_escape_html_utf8(zval *return_value, zval *input, zval *flags, zval *encoding, zval *double_encode);
+
+/* Escapes a URL as rawurlencode() does */
+void phalcon_escape_url(zval *return_value, zval *input);
+
+#endif /* PHALCON_HTML_ESCAPER_UTF8_H */
@@ -0,0 +1,415 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Image kernels working on the pixels of GD truecolor images. The buffer of
+ * a GdImage object is fetched through the function exported by the gd
+ * extension, looked up once when it is loaded, so phalcon does not link
+ * against it. The layout of the image is the one of the GD headers found
+ * at build time, so the buffer is only used when the gd extension reports
+ * the same libgd version and the same bundled or system library. Palette
+ * images, other libgd versions, or builds without the GD headers, return
+ * false and are processed by the adapter in userland.
+ *
+ * The inner loops are kept free of branches so the compiler vectorizes
+ * them.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "kernel/main.h"
+
+#include <math.h>
+
+#include "phalcon/image/adapter/kernels.h"
+
+#ifdef __has_include
+# if __has_include(<ext/gd/libgd/gd.h>)
+#  include <ext/gd/libgd/gd.h>
+#  define PHALCON_IMAGE_GD_BUNDLED 1
+# elif __has_include(<gd.h>)
+#  include <gd.h>
+#  define PHALCON_IMAGE_GD_BUNDLED 0
+# endif
+#endif
+
+#if defined(PHALCON_IMAGE_GD_BUNDLED) && defined(GD_MAJOR_VERSION) && defined(GD_MINOR_VERSION)
+# define PHALCON_IMAGE_GD 1
+#endif
+
+#if defined(PHALCON_IMAGE_GD) && (defined(HAVE_LIBDL) || defined(ZEND_WIN32))
+
+/**
+ * Number of box blurs approximating a gaussian blur
+ */
+#define PHALCON_IMAGE_BOXES 3
+
+typedef gdImagePtr (*phalcon_image_gd_fetch_t)(zval *image);
+
+/**
+ * Whether the libgd of the gd extension is the one of the headers phalcon
+ * was built with, comparing its version constants
+ */
+static int phalcon_image_gd_compatible(void)
+{
+	zval *major, *minor, *bundled;
+
+	major   = zend_get_constant_str(ZEND_STRL("GD_MAJOR_VERSION"));
+	minor   = zend_get_constant_str(ZEND_STRL("GD_MINOR_VERSION"));
+	bundled = zend_get_constant_str(ZEND_STRL("GD_BUNDLED"));
+
+	if (major == NULL || minor == NULL || bundled == NULL) {
+		return 0;
+	}
+
+	if (Z_TYPE_P(major) != IS_LONG || Z_TYPE_P(minor) != IS_LONG || Z_TYPE_P(bundled) != IS_LONG) {
+		return 0;
+	}
+
+	return Z_LVAL_P(major) == GD_MAJOR_VERSION
+		&& Z_LVAL_P(minor) == GD_MINOR_VERSION
+		&& Z_LVAL_P(bundled) == PHALCON_IMAGE_GD_BUNDLED;
+}
+
+/**
+ * Returns the GD image of a GdImage object, NULL when it is not a truecolor
+ * image, the gd extension does not export its buffer or its libgd does not
+ * match the headers
+ */
+static gdImagePtr phalcon_image_gd_fetch(zval *image)
+{
+	static phalcon_image_gd_fetch_t fetch = NULL;
+	static int looked_up = 0;
+	zend_module_entry *module;
+	gdImagePtr im;
+	DL_HANDLE handle;
+
+	if (Z_TYPE_P(image) != IS_OBJECT || !zend_string_equals_literal(Z_OBJCE_P(image)->name, "GdImage")) {
+		return NULL;
+	}
+
+	if (!looked_up) {
+		looked_up = 1;
+		module    = zend_hash_str_find_ptr(&module_registry, "gd", sizeof("gd") - 1);
+
+		if (module == NULL || !phalcon_image_gd_compatible()) {
+			return NULL;
+		}
+
+		handle = (DL_HANDLE) module->handle;
+
+#ifndef ZEND_WIN32
+		/**
+		 * A static gd extension lives in the executable
+		 */
+		if (handle == NULL) {
+			handle = dlopen(NULL, RTLD_LAZY);
+		}
+#endif
+
+		if (handle != NULL) {
+			fetch = (phalcon_image_gd_fetch_t) DL_FETCH_SYMBOL(handle, "php_gd_libgdimageptr_from_zval_p");
+		}
+	}
+
+	if (fetch == NULL) {
+		return NULL;
+	}
+
+	im = fetch(image);
+
+	if (im == NULL || !gdImageTrueColor(im) || gdImageSX(im) <= 0 || gdImageSY(im) <= 0) {
+		return NULL;
+	}
+
+	return im;
+}
+
+/**
+ * Box blur of the rows of a plane, the edges are clamped
+ */
+static void phalcon_image_box_rows(const unsigned char *source, unsigned char *target, int width, int height, int radius)
+{
+	unsigned int sum, multiplier = 65536 / (2 * radius + 1);
+	const unsigned char *row;
+	int x, y, i;
+
+	for (y = 0; y < height; y++) {
+		row = source + (size_t) y * width;
+		sum = row[0] * (radius + 1);
+
+		for (i = 1; i <= radius; i++) {
+			sum += row[MIN(i, width - 1)];
+		}
+
+		for (x = 0; x < width; x++) {
+			target[(size_t) y * width + x] = (unsigned char) ((sum * multiplier + 32768) >> 16);
+			sum += row[MIN(x + radius + 1, width - 1)] - row[MAX(x - radius, 0)];
+		}
+	}
+}
+
+/**
+ * Box blur of the columns of a plane, one row at a time so every column is
+ * summed in the same loop
+ */
+static void phalcon_image_box_columns(const unsigned char *source, unsigned char *target, unsigned int *sums, int width, int height, int radius)
+{
+	unsigned int multiplier = 65536 / (2 * radius + 1);
+	const unsigned char *add, *remove;
+	int x, y, i;
+
+	for (x = 0; x < width; x++) {
+		sums[x] = source[x] * (radius + 1);
+	}
+
+	for (i = 1; i <= radius; i++) {
+		add = source + (size_t) MIN(i, height - 1) * width;
+
+		for (x = 0; x < width; x++) {
+			sums[x] += add[x];
+		}
+	}
+
+	for (y = 0; y < height; y++) {
+		add    = source + (size_t) MIN(y + radius + 1, height - 1) * width;
+		remove = source + (size_t) MAX(y - radius, 0) * width;
+
+		for (x = 0; x < width; x++) {
+			target[(size_t) y * width + x] = (unsigned char) ((sums[x] * multiplier + 32768) >> 16);
+			sums[x] += add[x] - remove[x];
+		}
+	}
+}
+
+/**
+ * Sizes of the boxes whose successive blurs approximate a gaussian blur of
+ * the given variance
+ */
+static void phalcon_image_box_sizes(double variance, int *sizes)
+{
+	double ideal = sqrt(12.0 * variance / PHALCON_IMAGE_BOXES + 1.0);
+	int lower = (int) floor(ideal), count, i;
+
+	if (lower % 2 == 0) {
+		lower--;
+	}
+
+	count = (int) round(
+		(12.0 * variance - PHALCON_IMAGE_BOXES * lower * lower - 4.0 * PHALCON_IMAGE_BOXES * lower - 3.0 * PHALCON_IMAGE_BOXES)
+		/ (-4.0 * lower - 4.0)
+	);
+
+	for (i = 0; i < PHALCON_IMAGE_BOXES; i++) {
+		sizes[i] = i < count ? lower : lower + 2;
+	}
+}
+
+#endif
+
+/**
+ * Gaussian blur of the color channels, the alpha channel is kept as GD
+ * does. A radius of n has the variance of n passes of the 3x3 gaussian
+ * filter of imagefilter(), approximated by three box blurs in each
+ * direction, so the cost per pixel does not depend on the radius
+ */
+void phalcon_image_gd_blur(zval *return_value, zval *image, zval *radius)
+{
+#if defined(PHALCON_IMAGE_GD) && (defined(HAVE_LIBDL) || defined(ZEND_WIN32))
+	gdImagePtr im = phalcon_image_gd_fetch(image);
+	unsigned char *plane, *buffer, *row;
+	unsigned int *sums;
+	int sizes[PHALCON_IMAGE_BOXES], width, height, channel, shift, x, y, i, *pixels;
+	size_t size;
+
+	if (im == NULL) {
+		RETURN_FALSE;
+	}
+
+	width  = gdImageSX(im);
+	height = gdImageSY(im);
+	size   = (size_t) width * height;
+
+	phalcon_image_box_sizes(MAX(zval_get_long(radius), 1) / 2.0, sizes);
+
+	plane  = safe_emalloc(size, 2, 0);
+	buffer = plane + size;
+	sums   = safe_emalloc(width, sizeof(unsigned int), 0);
+
+	for (channel = 0; channel < 3; channel++) {
+		shift = 16 - 8 * channel;
+
+		for (y = 0; y < height; y++) {
+			pixels = im->tpixels[y];
+			row    = plane + (size_t) y * width;
+
+			for (x = 0; x < width; x++) {
+				row[x] = (unsigned char) (pixels[x] >> shift);
+			}
+		}
+
+		for (i = 0; i < PHALCON_IMAGE_BOXES; i++) {
+			if (sizes[i] < 3) {
+				continue;
+			}
+
+			phalcon_image_box_rows(plane, buffer, width, height, sizes[i] / 2);
+			phalcon_image_box_columns(buffer, plane, sums, width, height, sizes[i] / 2);
+		}
+
+		for (y = 0; y < height; y++) {
+			pixels = im->tpixels[y];
+			row    = plane + (size_t) y * width;
+
+			for (x = 0; x < width; x++) {
+				pixels[x] = (pixels[x] & ~(0xFF << shift)) | (row[x] << shift);
+			}
+		}
+	}
+
+	efree(sums);
+	efree(plane);
+
+	RETURN_TRUE;
+#else
+	RETURN_FALSE;
+#endif
+}
+
+/**
+ * Fills every block of amount x amount pixels with the average of its
+ * colors. The blocks on the right and bottom edges are the remainders
+ */
+void phalcon_image_gd_pixelate(zval *return_value, zval *image, zval *amount)
+{
+#if defined(PHALCON_IMAGE_GD) && (defined(HAVE_LIBDL) || defined(ZEND_WIN32))
+	gdImagePtr im = phalcon_image_gd_fetch(image);
+	uint64_t *sums, *sum, count;
+	int width, height, block, blocks, top, bottom, left, right, x, y, b, color, *pixels;
+
+	if (im == NULL) {
+		RETURN_FALSE;
+	}
+
+	width  = gdImageSX(im);
+	height = gdImageSY(im);
+	block  = (int) MIN(MAX(zval_get_long(amount), 1), MAX(width, height));
+	blocks = (width + block - 1) / block;
+	sums   = safe_emalloc(blocks, 4 * sizeof(uint64_t), 0);
+
+	for (top = 0; top < height; top += block) {
+		bottom = MIN(top + block, height);
+
+		memset(sums, 0, (size_t) blocks * 4 * sizeof(uint64_t));
+
+		/**
+		 * The sums of every block of the band are collected reading the
+		 * rows once
+		 */
+		for (y = top; y < bottom; y++) {
+			pixels = im->tpixels[y];
+
+			for (b = 0; b < blocks; b++) {
+				sum   = sums + (size_t) b * 4;
+				left  = b * block;
+				right = MIN(left + block, width);
+
+				for (x = left; x < right; x++) {
+					sum[0] += (pixels[x] >> 24) & 0x7F;
+					sum[1] += (pixels[x] >> 16) & 0xFF;
+					sum[2] += (pixels[x] >> 8) & 0xFF;
+					sum[3] += pixels[x] & 0xFF;
+				}
+			}
+		}
+
+		for (b = 0; b < blocks; b++) {
+			sum   = sums + (size_t) b * 4;
+			left  = b * block;
+			right = MIN(left + block, width);
+
+			count = (uint64_t) (right - left) * (bottom - top);
+			color = (int) (((sum[0] + count / 2) / count) << 24
+				| ((sum[1] + count / 2) / count) << 16
+				| ((sum[2] + count / 2) / count) << 8
+				| ((sum[3] + count / 2) / count));
+
+			for (y = top; y < bottom; y++) {
+				pixels = im->tpixels[y];
+
+				for (x = left; x < right; x++) {
+					pixels[x] = color;
+				}
+			}
+		}
+	}
+
+	efree(sums);
+
+	RETURN_TRUE;
+#else
+	RETURN_FALSE;
+#endif
+}
+
+/**
+ * Writes the mirrored rows of the image below it in the reflection image,
+ * adding the opacity of each row to their alpha channel as the colorize
+ * filter of GD does, in a single pass
+ */
+void phalcon_image_gd_reflection(zval *return_value, zval *reflection, zval *image, zval *height, zval *opacity, zval *stepping, zval *fade_in)
+{
+#if defined(PHALCON_IMAGE_GD) && (defined(HAVE_LIBDL) || defined(ZEND_WIN32))
+	gdImagePtr source, target;
+	zend_long rows, base, step, offset, alpha;
+	int width, sourceHeight, sourceY, targetY, x, fadeIn, added, value, *from, *to;
+
+	source = phalcon_image_gd_fetch(image);
+	target = phalcon_image_gd_fetch(reflection);
+
+	if (source == NULL || target == NULL) {
+		RETURN_FALSE;
+	}
+
+	rows         = zval_get_long(height);
+	base         = zval_get_long(opacity);
+	step         = zval_get_long(stepping);
+	fadeIn       = zend_is_true(fade_in);
+	width        = MIN(gdImageSX(source), gdImageSX(target));
+	sourceHeight = gdImageSY(source);
+
+	for (offset = 0; offset <= rows; offset++) {
+		sourceY = (int) (sourceHeight - offset - 1);
+		targetY = (int) (sourceHeight + offset);
+
+		if (sourceY < 0 || targetY >= gdImageSY(target)) {
+			continue;
+		}
+
+		alpha = base + step * (fadeIn ? rows - offset : offset);
+		added = (int) MAX(MIN(alpha, gdAlphaTransparent), 0);
+		from  = source->tpixels[sourceY];
+		to    = target->tpixels[targetY];
+
+		for (x = 0; x < width; x++) {
+			value = ((from[x] >> 24) & 0x7F) + added;
+			to[x] = (MIN(value, gdAlphaTransparent) << 24) | (from[x] & 0xFFFFFF);
+		}
+	}
+
+	RETURN_TRUE;
+#else
+	RETURN_FALSE;
+#endif
+}
@@ -0,0 +1,21 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_IMAGE_ADAPTER_KERNELS_H
+#define PHALCON_IMAGE_ADAPTER_KERNELS_H
+
+#include <Zend/zend.h>
+
+/* Process a GD truecolor image in place, false when it must be done in userland */
+void phalcon_image_gd_blur(zval *return_value, zval *image, zval *radius);
+void phalcon_image_gd_pixelate(zval *return_value, zval *image, zval *amount);
+void phalcon_image_gd_reflection(zval *return_value, zval *reflection, zval *image, zval *height, zval *opacity, zval *stepping, zval *fade_in);
+
+#endif /* PHALCON_IMAGE_ADAPTER_KERNELS_H */
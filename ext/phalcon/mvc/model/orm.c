@@ -22,6 +22,21 @@
 #include <zend_smart_str.h>
 #endif
 
+#include "phalcon/mvc/model/orm.h"
+
+/**
+ * Entry of the persistent PHQL cache. The entries live in the module globals
+ * (orm.phql_cache), which outlive the requests and are local to the process
+ * or to the thread on ZTS builds, so no locking is required. The table is
+ * kept in use order: a hit moves its entry to the end, so the least
+ * recently used entry is the first one
+ */
+typedef struct _phalcon_orm_phql_cache_entry {
+	zend_string *key;
+	zval value;
+	size_t size;
+} phalcon_orm_phql_cache_entry;
+
 /**
  * Destroyes the prepared ASTs
  */
@@ -89,3 +104,323 @@ void phalcon_orm_singlequotes(zval *return_value, zval *str) {
 	smart_str_free(&escaped_str);
 	RETURN_EMPTY_STRING();
 }
+
+/**
+ * Frees a value allocated in the persistent heap
+ */
+static void phalcon_orm_phql_cache_free_zval(zval *value) {
+
+	switch (Z_TYPE_P(value)) {
+
+		case IS_STRING:
+			zend_string_release(Z_STR_P(value));
+			break;
+
+		case IS_ARRAY:
+			zend_hash_destroy(Z_ARRVAL_P(value));
+			pefree(Z_ARRVAL_P(value), 1);
+			break;
+	}
+}
+
+/**
+ * Copies a request value into the persistent heap. Only scalars and arrays
+ * can be stored
+ */
+static int phalcon_orm_phql_cache_persist(zval *dest, zval *src, size_t *size) {
+
+	HashTable *ht;
+	zend_string *key;
+	zend_ulong idx;
+	zval *item, tmp;
+
+	ZVAL_DEREF(src);
+
+	switch (Z_TYPE_P(src)) {
+
+		case IS_NULL:
+		case IS_FALSE:
+		case IS_TRUE:
+		case IS_LONG:
+		case IS_DOUBLE:
+			ZVAL_COPY_VALUE(dest, src);
+			return SUCCESS;
+
+		case IS_STRING:
+			ZVAL_NEW_STR(dest, zend_string_init(Z_STRVAL_P(src), Z_STRLEN_P(src), 1));
+			*size += _ZSTR_STRUCT_SIZE(Z_STRLEN_P(src));
+			return SUCCESS;
+
+		case IS_ARRAY:
+			ht = pemalloc(sizeof(HashTable), 1);
+			zend_hash_init(ht, zend_hash_num_elements(Z_ARRVAL_P(src)), NULL, phalcon_orm_phql_cache_free_zval, 1);
+			ZVAL_ARR(dest, ht);
+
+			*size += sizeof(HashTable) + zend_hash_num_elements(Z_ARRVAL_P(src)) * sizeof(Bucket);
+
+			ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(src), idx, key, item) {
+
+				if (phalcon_orm_phql_cache_persist(&tmp, item, size) == FAILURE) {
+					phalcon_orm_phql_cache_free_zval(dest);
+					ZVAL_UNDEF(dest);
+					return FAILURE;
+				}
+
+				if (key) {
+					zend_hash_str_update(ht, ZSTR_VAL(key), ZSTR_LEN(key), &tmp);
+					*size += _ZSTR_STRUCT_SIZE(ZSTR_LEN(key));
+				} else {
+					zend_hash_index_update(ht, idx, &tmp);
+				}
+
+			} ZEND_HASH_FOREACH_END();
+
+			return SUCCESS;
+	}
+
+	return FAILURE;
+}
+
+/**
+ * Copies a persistent value back into the request heap
+ */
+static void phalcon_orm_phql_cache_copy(zval *dest, zval *src) {
+
+	zend_string *key;
+	zend_ulong idx;
+	zval *item, tmp;
+
+	switch (Z_TYPE_P(src)) {
+
+		case IS_STRING:
+			ZVAL_STRINGL(dest, Z_STRVAL_P(src), Z_STRLEN_P(src));
+			break;
+
+		case IS_ARRAY:
+			array_init_size(dest, zend_hash_num_elements(Z_ARRVAL_P(src)));
+
+			ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(src), idx, key, item) {
+
+				phalcon_orm_phql_cache_copy(&tmp, item);
+
+				if (key) {
+					zend_hash_str_update(Z_ARRVAL_P(dest), ZSTR_VAL(key), ZSTR_LEN(key), &tmp);
+				} else {
+					zend_hash_index_update(Z_ARRVAL_P(dest), idx, &tmp);
+				}
+
+			} ZEND_HASH_FOREACH_END();
+			break;
+
+		default:
+			ZVAL_COPY_VALUE(dest, src);
+	}
+}
+
+/**
+ * Removes an entry from the table and frees it
+ */
+static void phalcon_orm_phql_cache_remove(zephir_struct_orm *orm, phalcon_orm_phql_cache_entry *entry) {
+
+	zend_hash_del(orm->phql_cache, entry->key);
+
+	orm->phql_cache_used -= entry->size;
+
+	zend_string_release(entry->key);
+	phalcon_orm_phql_cache_free_zval(&entry->value);
+	pefree(entry, 1);
+}
+
+/**
+ * Returns the least recently used entry
+ */
+static phalcon_orm_phql_cache_entry *phalcon_orm_phql_cache_oldest(zephir_struct_orm *orm) {
+
+	phalcon_orm_phql_cache_entry *entry;
+
+	ZEND_HASH_FOREACH_PTR(orm->phql_cache, entry) {
+		return entry;
+	} ZEND_HASH_FOREACH_END();
+
+	return NULL;
+}
+
+/**
+ * Builds the lookup key: the kind of the entry followed by the full PHQL
+ */
+static char *phalcon_orm_phql_cache_key(char kind, const char *phql, size_t phql_length) {
+
+	char *key = emalloc(phql_length + 1);
+
+	key[0] = kind;
+	memcpy(key + 1, phql, phql_length);
+
+	return key;
+}
+
+/**
+ * Looks up a value in the persistent PHQL cache
+ */
+int phalcon_orm_phql_cache_find(zval *result, char kind, const char *phql, size_t phql_length) {
+
+	zephir_struct_orm *orm = &ZEPHIR_VGLOBAL->orm;
+	phalcon_orm_phql_cache_entry *entry = NULL;
+	char *key;
+
+	if (orm->phql_cache != NULL) {
+		key = phalcon_orm_phql_cache_key(kind, phql, phql_length);
+		entry = zend_hash_str_find_ptr(orm->phql_cache, key, phql_length + 1);
+		efree(key);
+	}
+
+	if (entry == NULL) {
+		orm->phql_cache_misses++;
+		return FAILURE;
+	}
+
+	orm->phql_cache_hits++;
+
+	/**
+	 * The key is kept alive by the entry while it is moved to the end
+	 */
+	zend_hash_del(orm->phql_cache, entry->key);
+	zend_hash_add_new_ptr(orm->phql_cache, entry->key, entry);
+
+	phalcon_orm_phql_cache_copy(result, &entry->value);
+
+	return SUCCESS;
+}
+
+/**
+ * Stores a value in the persistent PHQL cache, evicting the least recently
+ * used entries above the configured limits
+ */
+void phalcon_orm_phql_cache_store(char kind, const char *phql, size_t phql_length, zval *value) {
+
+	zephir_struct_orm *orm = &ZEPHIR_VGLOBAL->orm;
+	phalcon_orm_phql_cache_entry *entry, *oldest;
+	zend_long max_entries, max_memory;
+	char *key;
+
+	max_entries = orm->phql_cache_size;
+	max_memory = orm->phql_cache_memory;
+
+	if (max_entries <= 0) {
+		return;
+	}
+
+	if (orm->phql_cache == NULL) {
+		orm->phql_cache = pemalloc(sizeof(HashTable), 1);
+		zend_hash_init(orm->phql_cache, 0, NULL, NULL, 1);
+	}
+
+	key = phalcon_orm_phql_cache_key(kind, phql, phql_length);
+
+	entry = zend_hash_str_find_ptr(orm->phql_cache, key, phql_length + 1);
+	if (entry != NULL) {
+		phalcon_orm_phql_cache_remove(orm, entry);
+	}
+
+	entry = pecalloc(1, sizeof(phalcon_orm_phql_cache_entry), 1);
+	entry->size = sizeof(phalcon_orm_phql_cache_entry) + _ZSTR_STRUCT_SIZE(phql_length + 1);
+
+	if (phalcon_orm_phql_cache_persist(&entry->value, value, &entry->size) == FAILURE ||
+		(max_memory > 0 && entry->size > (size_t) max_memory)) {
+		if (Z_TYPE(entry->value) != IS_UNDEF) {
+			phalcon_orm_phql_cache_free_zval(&entry->value);
+		}
+		pefree(entry, 1);
+		efree(key);
+		return;
+	}
+
+	entry->key = zend_string_init(key, phql_length + 1, 1);
+	efree(key);
+
+	zend_hash_add_new_ptr(orm->phql_cache, entry->key, entry);
+	orm->phql_cache_used += entry->size;
+
+	while (((zend_long) zend_hash_num_elements(orm->phql_cache) > max_entries ||
+		(max_memory > 0 && orm->phql_cache_used > max_memory)) &&
+		(oldest = phalcon_orm_phql_cache_oldest(orm)) != NULL && oldest != entry) {
+		phalcon_orm_phql_cache_remove(orm, oldest);
+		orm->phql_cache_evictions++;
+	}
+}
+
+/**
+ * Returns a prepared intermediate representation from the persistent cache
+ */
+void phalcon_orm_phql_cache_get(zval *return_value, zval *phql) {
+
+	zend_phalcon_globals *phalcon_globals_ptr = ZEPHIR_VGLOBAL;
+
+	if (Z_TYPE_P(phql) != IS_STRING || phalcon_globals_ptr->orm.phql_cache_size <= 0) {
+		RETURN_NULL();
+	}
+
+	if (phalcon_orm_phql_cache_find(return_value, PHALCON_ORM_PHQL_CACHE_IR, Z_STRVAL_P(phql), Z_STRLEN_P(phql)) == FAILURE) {
+		RETURN_NULL();
+	}
+}
+
+/**
+ * Stores a prepared intermediate representation in the persistent cache
+ */
+void phalcon_orm_phql_cache_set(zval *phql, zval *value) {
+
+	if (Z_TYPE_P(phql) != IS_STRING) {
+		return;
+	}
+
+	phalcon_orm_phql_cache_store(PHALCON_ORM_PHQL_CACHE_IR, Z_STRVAL_P(phql), Z_STRLEN_P(phql), value);
+}
+
+/**
+ * Returns the counters of the persistent PHQL cache
+ */
+void phalcon_orm_phql_cache_stats(zval *return_value) {
+
+	zephir_struct_orm *orm = &ZEPHIR_VGLOBAL->orm;
+
+	array_init_size(return_value, 5);
+
+	add_assoc_long(return_value, "entries", orm->phql_cache ? zend_hash_num_elements(orm->phql_cache) : 0);
+	add_assoc_long(return_value, "memory", (zend_long) orm->phql_cache_used);
+	add_assoc_long(return_value, "hits", (zend_long) orm->phql_cache_hits);
+	add_assoc_long(return_value, "misses", (zend_long) orm->phql_cache_misses);
+	add_assoc_long(return_value, "evictions", (zend_long) orm->phql_cache_evictions);
+}
+
+/**
+ * Destroys the persistent PHQL cache of the given globals and resets its
+ * counters. Called on GSHUTDOWN, once per thread on ZTS builds
+ */
+void phalcon_orm_phql_cache_destroy(zend_phalcon_globals *phalcon_globals) {
+
+	zephir_struct_orm *orm = &phalcon_globals->orm;
+	phalcon_orm_phql_cache_entry *entry;
+
+	if (orm->phql_cache != NULL) {
+		while ((entry = phalcon_orm_phql_cache_oldest(orm)) != NULL) {
+			phalcon_orm_phql_cache_remove(orm, entry);
+		}
+
+		zend_hash_destroy(orm->phql_cache);
+		pefree(orm->phql_cache, 1);
+		orm->phql_cache = NULL;
+	}
+
+	orm->phql_cache_used = 0;
+	orm->phql_cache_hits = 0;
+	orm->phql_cache_misses = 0;
+	orm->phql_cache_evictions = 0;
+}
+
+/**
+ * Destroys the persistent PHQL cache of the current process or thread
+ */
+void phalcon_orm_phql_cache_clear() {
+
+	phalcon_orm_phql_cache_destroy(ZEPHIR_VGLOBAL);
+}
@@ -8,5 +8,25 @@
  * file that was distributed with this source code.
  */
 
+#ifndef PHALCON_MVC_MODEL_ORM_H
+#define PHALCON_MVC_MODEL_ORM_H
+
+#include "php_phalcon.h"
+
+/* Kinds of entries in the persistent PHQL cache */
+#define PHALCON_ORM_PHQL_CACHE_AST 'a'
+#define PHALCON_ORM_PHQL_CACHE_AST_LITERALS 'A'
+#define PHALCON_ORM_PHQL_CACHE_IR 'i'
+
 void phalcon_orm_destroy_cache();
 void phalcon_orm_singlequotes(zval *return_value, zval *str);
+
+int phalcon_orm_phql_cache_find(zval *result, char kind, const char *phql, size_t phql_length);
+void phalcon_orm_phql_cache_store(char kind, const char *phql, size_t phql_length, zval *value);
+void phalcon_orm_phql_cache_get(zval *return_value, zval *phql);
+void phalcon_orm_phql_cache_set(zval *phql, zval *value);
+void phalcon_orm_phql_cache_stats(zval *return_value);
+void phalcon_orm_phql_cache_clear();
+void phalcon_orm_phql_cache_destroy(zend_phalcon_globals *phalcon_globals);
+
+#endif
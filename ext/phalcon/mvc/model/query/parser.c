@@ -2663,6 +2663,8 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 	char *error;
 	unsigned long phql_key = 0;
 	zval *temp_ast;
+	char persistent_kind;
+	int persistent_cache;
 
 	if (!phql) {
 		ZVAL_STRING(*error_msg, "PHQL statement cannot be NULL");
@@ -2670,6 +2672,9 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 	}
 
 	cache_level = phalcon_globals_ptr->orm.cache_level;
+	persistent_cache = cache_level >= 0 && phalcon_globals_ptr->orm.phql_cache_size > 0;
+	persistent_kind = phalcon_globals_ptr->orm.enable_literals ? PHALCON_ORM_PHQL_CACHE_AST_LITERALS : PHALCON_ORM_PHQL_CACHE_AST;
+
 	if (cache_level >= 0) {
 		phql_key = zend_inline_hash_func(phql, phql_length + 1);
 		if (phalcon_globals_ptr->orm.parser_cache != NULL) {
@@ -2681,6 +2686,37 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 		}
 	}
 
+	/**
+	 * Check the persistent cache, keyed by the full PHQL text. The unique id
+	 * of the stored AST belongs to a previous request so it is replaced
+	 */
+	if (persistent_cache) {
+		if (phalcon_orm_phql_cache_find(*result, persistent_kind, phql, phql_length) == SUCCESS) {
+			if (Z_TYPE_P(*result) == IS_ARRAY) {
+				if (cache_level >= 1) {
+					add_assoc_long(*result, "id", phalcon_globals_ptr->orm.unique_cache_id++);
+				} else {
+					zend_hash_str_del(Z_ARRVAL_P(*result), SL("id"));
+				}
+			}
+
+			if (!phalcon_globals_ptr->orm.parser_cache) {
+				ALLOC_HASHTABLE(phalcon_globals_ptr->orm.parser_cache);
+				zend_hash_init(phalcon_globals_ptr->orm.parser_cache, 0, NULL, ZVAL_PTR_DTOR, 0);
+			}
+
+			Z_TRY_ADDREF_P(*result);
+
+			zend_hash_index_update(
+				phalcon_globals_ptr->orm.parser_cache,
+				phql_key,
+				*result
+			);
+
+			return SUCCESS;
+		}
+	}
+
 	phql_parser = phql_Alloc(phql_wrapper_alloc);
 
 	parser_status = emalloc(sizeof(phql_parser_status));
@@ -3076,6 +3112,10 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 						phql_key,
 						*result
 					);
+
+					if (persistent_cache) {
+						phalcon_orm_phql_cache_store(persistent_kind, phql, phql_length, *result);
+					}
 				}
 
 			}
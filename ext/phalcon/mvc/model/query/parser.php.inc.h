@@ -16,6 +16,8 @@
 #include "kernel/fcall.h"
 #include "kernel/exception.h"
 
+#include "phalcon/mvc/model/orm.h"
+
 #define phql_add_assoc_stringl(var, index, str, len, copy) add_assoc_stringl(var, index, str, len);
 
 static void phql_ret_literal_zval(zval *ret, int type, phql_parser_token *T)
@@ -43,6 +43,13 @@ typedef struct _zephir_struct_orm {
 	zend_bool late_state_binding;
 	zend_bool not_null_validations;
 	HashTable*  parser_cache;
+	HashTable*  phql_cache;
+	long phql_cache_evictions;
+	long phql_cache_hits;
+	int phql_cache_memory;
+	long phql_cache_misses;
+	int phql_cache_size;
+	long phql_cache_used;
 	zend_string*  resultset_prefetch_records;
 	int unique_cache_id;
 	zend_bool update_snapshot_on_save;
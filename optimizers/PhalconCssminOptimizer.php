@@ -17,6 +17,7 @@ use Zephir\Call;
 use Zephir\CompilationContext;
 use Zephir\CompiledExpression;
 use Zephir\Exception\CompilerException;
+use Zephir\HeadersManager;
 use Zephir\Optimizers\OptimizerAbstract;
 
 class PhalconCssminOptimizer extends OptimizerAbstract
@@ -60,7 +61,10 @@ class PhalconCssminOptimizer extends OptimizerAbstract
             $symbolVariable->initVariant($context);
         }
 
-        $context->headersManager->add('phalcon/assets/filters/cssminifier');
+        $context->headersManager->add(
+            'phalcon/assets/filters/cssminifier',
+            HeadersManager::POSITION_LAST
+        );
 
         $symbolVariable->setDynamicTypes('string');
 
@@ -70,8 +74,9 @@ class PhalconCssminOptimizer extends OptimizerAbstract
             $expression
         );
 
+        $symbol = $context->backend->getVariableCode($symbolVariable);
         $context->codePrinter->output(
-            'phalcon_cssmin(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ');'
+            'phalcon_cssmin(' . $symbol . ', ' . $resolvedParams[0] . ');'
         );
 
         return new CompiledExpression(
@@ -17,6 +17,7 @@ use Zephir\Call;
 use Zephir\CompilationContext;
 use Zephir\CompiledExpression;
 use Zephir\Exception\CompilerException;
+use Zephir\HeadersManager;
 use Zephir\Optimizers\OptimizerAbstract;
 
 class PhalconJsminOptimizer extends OptimizerAbstract
@@ -60,7 +61,10 @@ class PhalconJsminOptimizer extends OptimizerAbstract
             $symbolVariable->initVariant($context);
         }
 
-        $context->headersManager->add('phalcon/assets/filters/jsminifier');
+        $context->headersManager->add(
+            'phalcon/assets/filters/jsminifier',
+            HeadersManager::POSITION_LAST
+        );
 
         $symbolVariable->setDynamicTypes('string');
 
@@ -70,8 +74,9 @@ class PhalconJsminOptimizer extends OptimizerAbstract
             $expression
         );
 
+        $symbol = $context->backend->getVariableCode($symbolVariable);
         $context->codePrinter->output(
-            'phalcon_jsmin(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ');'
+            'phalcon_jsmin(' . $symbol . ', ' . $resolvedParams[0] . ');'
         );
 
         return new CompiledExpression(
@@ -82,6 +82,12 @@ use ReflectionFunction;
  *         $acl->allow("Users", $component, $action);
  *     }
  * }
+ *
+ * // Resolve inheritance and wildcards ahead of time and keep the result
+ * apcu_store("acl", $acl->compile());
+ *
+ * $acl = new \Phalcon\Acl\Adapter\Memory();
+ * $acl->loadCompiled(apcu_fetch("acl"));
  *```
  */
 class Memory extends AbstractAdapter
@@ -121,6 +127,13 @@ class Memory extends AbstractAdapter
      */
     protected activeKey = null;
 
+    /**
+     * Decision matrix built by compile()
+     *
+     * @var array|null
+     */
+    protected compiled = null;
+
     /**
      * Components
      *
@@ -241,7 +254,8 @@ class Memory extends AbstractAdapter
             throw new Exception("Invalid value for the accessList");
         }
 
-        let exists = true;
+        let exists         = true,
+            this->compiled = null;
 
         if typeof accessList === "array" {
             for accessName in accessList {
@@ -278,6 +292,8 @@ class Memory extends AbstractAdapter
 
         this->checkExists(this->roles, roleName, "Role", "role list");
 
+        let this->compiled = null;
+
         if !isset this->roleInherits[roleName] {
             let this->roleInherits[roleName] = [];
         }
@@ -400,7 +416,8 @@ class Memory extends AbstractAdapter
             return false;
         }
 
-        let this->roles[roleName] = roleObject;
+        let this->roles[roleName] = roleObject,
+            this->compiled        = null;
 
         if null !== accessInherits {
             return this->addInherit(roleName, accessInherits);
@@ -446,6 +463,92 @@ class Memory extends AbstractAdapter
         }
     }
 
+    /**
+     * Resolves the inheritance and the wildcards of every role, component
+     * and access into a decision matrix indexed by integer ids, used by
+     * isAllowed() until the ACL is modified. Returns the matrix serialized,
+     * to be restored with loadCompiled()
+     *
+     * ```php
+     * apcu_store("acl", $acl->compile());
+     * ```
+     */
+    public function compile() -> string
+    {
+        var accessKey, accessName, accesses, componentName, keyIndex, pairId,
+            position, roleName;
+        array components, decisions, keyIndexes, keys, roles;
+        int pairCount, roleId;
+
+        let components = [],
+            decisions  = [],
+            keyIndexes = [],
+            keys       = [],
+            roles      = [],
+            pairCount  = 0;
+
+        /**
+         * Every component gets an id for each of its accesses. The `*`
+         * access answers the accesses the component does not have
+         */
+        for componentName, _ in this->componentsNames {
+            let components[componentName] = ["*": pairCount];
+            let pairCount++;
+        }
+
+        for accessKey, _ in this->accessList {
+            let position      = strpos(accessKey, "!"),
+                componentName = substr(accessKey, 0, position),
+                accessName    = substr(accessKey, position + 1);
+
+            if isset components[componentName] && !isset components[componentName][accessName] {
+                let components[componentName][accessName] = pairCount;
+                let pairCount++;
+            }
+        }
+
+        if typeof this->roles === "array" {
+            for roleName, _ in this->roles {
+                let roleId          = count(roles),
+                    roles[roleName] = roleId;
+
+                for componentName, accesses in components {
+                    for accessName, pairId in accesses {
+                        let accessKey = this->canAccess(roleName, componentName, accessName);
+
+                        if accessKey === false {
+                            continue;
+                        }
+
+                        if !fetch keyIndex, keyIndexes[accessKey] {
+                            let keyIndex              = count(keys),
+                                keyIndexes[accessKey] = keyIndex,
+                                keys[]                = [
+                                    accessKey,
+                                    this->access[accessKey],
+                                    isset this->func[accessKey]
+                                ];
+                        }
+
+                        let decisions[roleId * pairCount + pairId] = keyIndex;
+                    }
+                }
+            }
+        }
+
+        let this->compiled = [
+            "roles"                    : roles,
+            "components"               : components,
+            "pairCount"                : pairCount,
+            "decisions"                : decisions,
+            "keys"                     : keys,
+            "defaultAccess"            : this->defaultAccess,
+            "noArgumentsDefaultAction" : this->noArgumentsDefaultAction
+        ];
+
+        return serialize(this->compiled);
+    }
+
     /**
      * Deny access to a role on a component. You can use `*` as wildcard
      *
@@ -498,6 +601,8 @@ class Memory extends AbstractAdapter
             let localAccess = accessList;
         }
 
+        let this->compiled = null;
+
         if typeof accessList === "array" {
             for accessName in localAccess {
                 let accessKey = componentName . "!" . accessName;
@@ -598,7 +703,8 @@ class Memory extends AbstractAdapter
             numberOfRequiredParameters, parameterNumber, parameterToCheck,
             parametersForFunction, reflectionClass, reflectionFunction,
             reflectionParameter, reflectionParameters, reflectionType,
-            roleObject = null, userParametersSizeShouldBe;
+            roleObject = null, userParametersSizeShouldBe, compiledRoles,
+            roleId, rule;
         bool hasComponent = false, hasRole = false;
 
         if typeof roleName === "object" {
@@ -644,22 +750,51 @@ class Memory extends AbstractAdapter
             return false;
         }
 
-        /**
-         * Check if the role exists
-         */
-        if !isset this->roles[roleName] {
-            return (this->defaultAccess == Enum::ALLOW);
-        }
+        if this->compiled !== null {
+            /**
+             * Check if the role exists in the decision matrix
+             */
+            let compiledRoles = this->compiled["roles"];
 
-        /**
-         * Check if there is a direct combination for role-component-access
-         */
-        let accessKey = this->canAccess(roleName, componentName, access);
+            if !fetch roleId, compiledRoles[roleName] {
+                return (this->defaultAccess == Enum::ALLOW);
+            }
+
+            let accessKey = false,
+                rule      = this->canAccessCompiled(roleId, componentName, access);
+
+            if rule !== null {
+                let accessKey  = rule[0],
+                    haveAccess = rule[1];
+
+                /**
+                 * The function of the rule is not part of the matrix
+                 */
+                if rule[2] && !fetch funcAccess, funcList[accessKey] {
+                    throw new Exception(
+                        "The function of the compiled rule '" . accessKey .
+                        "' is not defined in the ACL"
+                    );
+                }
+            }
+        } else {
+            /**
+             * Check if the role exists
+             */
+            if !isset this->roles[roleName] {
+                return (this->defaultAccess == Enum::ALLOW);
+            }
 
-        if null !== accessKey && isset accessList[accessKey] {
-            let haveAccess = accessList[accessKey];
+            /**
+             * Check if there is a direct combination for role-component-access
+             */
+            let accessKey = this->canAccess(roleName, componentName, access);
 
-            fetch funcAccess, funcList[accessKey];
+            if null !== accessKey && isset accessList[accessKey] {
+                let haveAccess = accessList[accessKey];
+
+                fetch funcAccess, funcList[accessKey];
+            }
         }
 
         /**
@@ -827,6 +962,34 @@ class Memory extends AbstractAdapter
         return isset this->componentsNames[componentName];
     }
 
+    /**
+     * Restores a decision matrix returned by compile(). The rules with a
+     * function need the same function in this ACL
+     *
+     * ```php
+     * $acl->loadCompiled(apcu_fetch("acl"));
+     * ```
+     */
+    public function loadCompiled(string! compiled) -> void
+    {
+        var matrix;
+
+        let matrix = unserialize(compiled, ["allowed_classes": false]);
+
+        if unlikely typeof matrix !== "array" ||
+            !isset matrix["roles"] ||
+            !isset matrix["components"] ||
+            !isset matrix["pairCount"] ||
+            !isset matrix["decisions"] ||
+            !isset matrix["keys"] {
+            throw new Exception("The compiled ACL is not valid");
+        }
+
+        let this->compiled                 = matrix,
+            this->defaultAccess            = matrix["defaultAccess"],
+            this->noArgumentsDefaultAction = matrix["noArgumentsDefaultAction"];
+    }
+
     /**
      * Sets the default access level (`Phalcon\Enum::ALLOW` or `Phalcon\Enum::DENY`)
      * for no arguments provided in isAllowed action if there exists func for
@@ -847,7 +1010,8 @@ class Memory extends AbstractAdapter
         this->checkExists(this->roles, roleName, "Role");
         this->checkExists(this->componentsNames, componentName, "Component");
 
-        let accessList = this->accessList;
+        let accessList     = this->accessList,
+            this->compiled = null;
 
         if typeof access == "array" {
             for accessName in access {
@@ -995,6 +1159,35 @@ class Memory extends AbstractAdapter
         return false;
     }
 
+    /**
+     * Returns the rule of the decision matrix for a role, component and
+     * access, or null when there is none. Unknown components are answered
+     * by the `*` component and unknown accesses by the `*` access
+     */
+    private function canAccessCompiled(int roleId, var componentName, var access) -> array | null
+    {
+        var accesses, components, decisions, keyIndex, keys, pairId;
+
+        let components = this->compiled["components"],
+            decisions  = this->compiled["decisions"],
+            keys       = this->compiled["keys"];
+
+        if !fetch accesses, components[componentName] {
+            let accesses = components["*"],
+                access   = "*";
+        }
+
+        if !fetch pairId, accesses[access] {
+            let pairId = accesses["*"];
+        }
+
+        if !fetch keyIndex, decisions[roleId * this->compiled["pairCount"] + pairId] {
+            return null;
+        }
+
+        return keys[keyIndex];
+    }
+
     /**
      * @param array  $collection
      * @param string $element
@@ -63,11 +63,17 @@ abstract class AbstractAdapter implements AdapterInterface
             let reader = this->getReader(),
                 parsedAnnotations = reader->parse(realClassName);
 
-            let classAnnotations = new Reflection(parsedAnnotations),
-                this->annotations[realClassName] = classAnnotations;
-                this->{"write"}(realClassName, classAnnotations);
+            let classAnnotations = new Reflection(parsedAnnotations);
+
+            this->{"write"}(realClassName, classAnnotations);
         }
 
+        /**
+         * Keep the reflection for the following lookups, whether it was
+         * read or parsed
+         */
+        let this->annotations[realClassName] = classAnnotations;
+
         return classAnnotations;
     }
 
@@ -110,16 +116,19 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     public function getProperty(string className, string propertyName) -> <Collection>
     {
-        var classAnnotations, properties, property;
+        var classAnnotations, property;
 
         /**
          * Get the full annotations from the class
          */
         let classAnnotations = this->get(className);
 
-        let properties = classAnnotations->getPropertiesAnnotations();
+        /**
+         * Only the collection of the property is built
+         */
+        let property = classAnnotations->getPropertyAnnotations(propertyName);
 
-        if !fetch property, properties[propertyName] {
+        if property === null {
             /**
              * Returns a collection anyways
              */
@@ -149,21 +158,20 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     public function getMethod(string className, string methodName) -> <Collection>
     {
-        var classAnnotations, methods, method, methodKey;
+        var classAnnotations, method;
 
         /**
          * Get the full annotations from the class
          */
         let classAnnotations = this->get(className);
 
-        let methods = classAnnotations->getMethodsAnnotations();
+        /**
+         * Only the collection of the method is built
+         */
+        let method = classAnnotations->getMethodAnnotations(methodName);
 
-        if typeof methods === "array" {
-            for methodKey, method in methods {
-                if !strcasecmp(methodKey, methodName) {
-                    return method;
-                }
-            }
+        if method !== null {
+            return method;
         }
 
         /**
@@ -0,0 +1,165 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Annotations\Adapter;
+
+use Phalcon\Annotations\Exception;
+use Phalcon\Annotations\Reflection;
+use ReflectionClass;
+
+/**
+ * Stores the parsed annotations of every class in a generated PHP file that
+ * returns a constant array, along with the path and modification time of the
+ * class file. With opcache enabled the array is kept immutable in shared
+ * memory by all the workers, so reading it costs no deserialization and no
+ * reflection, and the collections of a method or property are only built
+ * when they are looked up. The annotations are parsed again when the class
+ * file changes, unless the `stat` option is disabled
+ *
+ *```php
+ * use Phalcon\Annotations\Adapter\Compiled;
+ *
+ * $annotations = new Compiled(
+ *     [
+ *         "annotationsDir" => "app/cache/annotations/",
+ *         "stat"           => true,
+ *     ]
+ * );
+ *```
+ */
+class Compiled extends AbstractAdapter
+{
+    /**
+     * @var string
+     */
+    protected annotationsDir = "./";
+
+    /**
+     * @var bool
+     */
+    protected stat = true;
+
+    /**
+     * Phalcon\Annotations\Adapter\Compiled constructor
+     *
+     * @param array options = [
+     *     'annotationsDir' => './',
+     *     'stat'           => true
+     * ]
+     */
+    public function __construct(array options = [])
+    {
+        var annotationsDir, stat;
+
+        if fetch annotationsDir, options["annotationsDir"] {
+            let this->annotationsDir = annotationsDir;
+        }
+
+        if fetch stat, options["stat"] {
+            let this->stat = (bool) stat;
+        }
+    }
+
+    /**
+     * Reads the parsed annotations from the compiled file, or returns false
+     * when it is missing or older than the class file
+     */
+    public function read(string! key) -> <Reflection> | bool
+    {
+        var compiled, data, file, mtime;
+        string path;
+
+        let path = this->getCompiledPath(key);
+
+        if !file_exists(path) {
+            return false;
+        }
+
+        let compiled = require path;
+
+        if typeof compiled !== "array" {
+            return false;
+        }
+
+        if !fetch data, compiled["data"] {
+            return false;
+        }
+
+        if this->stat {
+            if !fetch file, compiled["file"] {
+                return false;
+            }
+
+            if !fetch mtime, compiled["mtime"] {
+                return false;
+            }
+
+            if file !== "" && (!file_exists(file) || filemtime(file) !== mtime) {
+                return false;
+            }
+        }
+
+        return new Reflection(data);
+    }
+
+    /**
+     * Writes the parsed annotations to the compiled file. The file is written
+     * to a temporary file first and renamed, so concurrent requests always
+     * include a complete file
+     */
+    public function write(string! key, <Reflection> data) -> void
+    {
+        var file, mtime, reflection, temporaryPath;
+        string path;
+
+        let file  = "",
+            mtime = 0;
+
+        /**
+         * The class file tells when the annotations are outdated
+         */
+        if class_exists(key) || interface_exists(key) || trait_exists(key) {
+            let reflection = new ReflectionClass(key),
+                file       = reflection->getFileName();
+
+            if file === false {
+                let file = "";
+            } else {
+                let mtime = filemtime(file);
+            }
+        }
+
+        let path          = this->getCompiledPath(key),
+            temporaryPath = path . "." . uniqid("", true) . ".tmp";
+
+        if unlikely file_put_contents(temporaryPath, "<?php return " . var_export(["file": file, "mtime": mtime, "data": data->getReflectionData()], true) . ";\n") === false {
+            throw new Exception("Annotations directory cannot be written");
+        }
+
+        if unlikely !rename(temporaryPath, path) {
+            unlink(temporaryPath);
+
+            throw new Exception("Annotations directory cannot be written");
+        }
+
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(path, true);
+        }
+    }
+
+    /**
+     * Returns the path of the compiled file of a class. Paths must be
+     * normalized before be used as keys
+     */
+    private function getCompiledPath(string! key) -> string
+    {
+        return this->annotationsDir . prepare_virtual_path(key, "_") . ".php";
+    }
+}
@@ -93,9 +93,10 @@ class AnnotationsFactory extends AbstractFactory
     protected function getServices() -> array
     {
         return [
-            "apcu"   : "Phalcon\\Annotations\\Adapter\\Apcu",
-            "memory" : "Phalcon\\Annotations\\Adapter\\Memory",
-            "stream" : "Phalcon\\Annotations\\Adapter\\Stream"
+            "apcu"     : "Phalcon\\Annotations\\Adapter\\Apcu",
+            "compiled" : "Phalcon\\Annotations\\Adapter\\Compiled",
+            "memory"   : "Phalcon\\Annotations\\Adapter\\Memory",
+            "stream"   : "Phalcon\\Annotations\\Adapter\\Stream"
         ];
     }
 }
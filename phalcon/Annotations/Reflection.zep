@@ -100,6 +100,83 @@ class Reflection
         return this->constantAnnotations;
     }
 
+    /**
+     * Returns the annotations found in the docblock of a method, building
+     * only its collection. Method names are case-insensitive
+     */
+    public function getMethodAnnotations(string! methodName) -> <Collection> | null
+    {
+        var collection, data, name, reflectionMethod, reflectionMethods;
+
+        if fetch collection, this->methodAnnotations[methodName] {
+            return collection;
+        }
+
+        if !fetch reflectionMethods, this->reflectionData["methods"] {
+            return null;
+        }
+
+        if typeof reflectionMethods !== "array" {
+            return null;
+        }
+
+        if !fetch reflectionMethod, reflectionMethods[methodName] {
+            let reflectionMethod = null;
+
+            for name, data in reflectionMethods {
+                if !strcasecmp(name, methodName) {
+                    let methodName       = name,
+                        reflectionMethod = data;
+
+                    break;
+                }
+            }
+
+            if reflectionMethod === null {
+                return null;
+            }
+
+            if fetch collection, this->methodAnnotations[methodName] {
+                return collection;
+            }
+        }
+
+        let collection = new Collection(reflectionMethod),
+            this->methodAnnotations[methodName] = collection;
+
+        return collection;
+    }
+
+    /**
+     * Returns the annotations found in the docblock of a property, building
+     * only its collection
+     */
+    public function getPropertyAnnotations(string! propertyName) -> <Collection> | null
+    {
+        var collection, reflectionProperties, reflectionProperty;
+
+        if fetch collection, this->propertyAnnotations[propertyName] {
+            return collection;
+        }
+
+        if !fetch reflectionProperties, this->reflectionData["properties"] {
+            return null;
+        }
+
+        if typeof reflectionProperties !== "array" {
+            return null;
+        }
+
+        if !fetch reflectionProperty, reflectionProperties[propertyName] {
+            return null;
+        }
+
+        let collection = new Collection(reflectionProperty),
+            this->propertyAnnotations[propertyName] = collection;
+
+        return collection;
+    }
+
     /**
      * Returns the annotations found in the properties' docblocks
      *
@@ -107,15 +184,14 @@ class Reflection
      */
     public function getPropertiesAnnotations() -> <Collection[]>
     {
-        var reflectionProperties, property, reflectionProperty;
+        var reflectionProperties;
 
         if fetch reflectionProperties, this->reflectionData["properties"] {
-            if typeof reflectionProperties === "array" && count(reflectionProperties) > 0 {
-                for property, reflectionProperty in reflectionProperties {
-                    let this->propertyAnnotations[property] = new Collection(
-                        reflectionProperty
-                    );
-                }
+            if typeof reflectionProperties === "array" && count(reflectionProperties) !== count(this->propertyAnnotations) {
+                let this->propertyAnnotations = this->buildCollections(
+                    reflectionProperties,
+                    this->propertyAnnotations
+                );
             }
         }
 
@@ -129,15 +205,14 @@ class Reflection
      */
     public function getMethodsAnnotations() -> <Collection[]>
     {
-        var reflectionMethods, methodName, reflectionMethod;
+        var reflectionMethods;
 
         if fetch reflectionMethods, this->reflectionData["methods"] {
-            if typeof reflectionMethods === "array" && count(reflectionMethods) > 0 {
-                for methodName, reflectionMethod in reflectionMethods {
-                    let this->methodAnnotations[methodName] = new Collection(
-                        reflectionMethod
-                    );
-                }
+            if typeof reflectionMethods === "array" && count(reflectionMethods) !== count(this->methodAnnotations) {
+                let this->methodAnnotations = this->buildCollections(
+                    reflectionMethods,
+                    this->methodAnnotations
+                );
             }
         }
 
@@ -154,4 +229,26 @@ class Reflection
     {
         return this->reflectionData;
     }
+
+    /**
+     * Returns the collections of the parsed docblocks in their declaration
+     * order, reusing the ones already built
+     */
+    private function buildCollections(array! reflectionData, array! built) -> array
+    {
+        var collection, name, data;
+        array collections;
+
+        let collections = [];
+
+        for name, data in reflectionData {
+            if !fetch collection, built[name] {
+                let collection = new Collection(data);
+            }
+
+            let collections[name] = collection;
+        }
+
+        return collections;
+    }
 }
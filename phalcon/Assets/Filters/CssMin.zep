@@ -15,17 +15,20 @@ use Phalcon\Assets\FilterInterface;
 /**
  * Minify the CSS - removes comments removes newlines and line feeds keeping
  * removes last semicolon from last property
+ *
+ * The minifier is native and runs in a single pass over the content, in
+ * linear time and without buffering anything but the output. Strings and
+ * escaped characters are copied as they are.
  */
 class Cssmin implements FilterInterface
 {
     /**
      * Filters the content using CSSMIN
      *
-     * > NOTE: This functionality is not currently available
-     * {: .alert .alert-info }
+     * @throws \Phalcon\Assets\Exception on unterminated comments or strings
      */
     public function filter(string! content) -> string
     {
-        return content;
+        return phalcon_cssmin(content);
     }
 }
@@ -16,17 +16,20 @@ use Phalcon\Assets\FilterInterface;
  * Deletes the characters which are insignificant to JavaScript. Comments will
  * be removed. Tabs will be replaced with spaces. Carriage returns will be
  * replaced with linefeeds. Most spaces and linefeeds will be removed.
+ *
+ * The minifier is native and runs in a single pass over the content, in
+ * linear time and without buffering anything but the output.
  */
 class Jsmin implements FilterInterface
 {
     /**
      * Filters the content using JSMIN
      *
-     * > NOTE: This functionality is not currently available
-     * {: .alert .alert-info }
+     * @throws \Phalcon\Assets\Exception on unterminated comments, strings,
+     *                                   templates or regular expressions
      */
     public function filter(string! content) -> string
     {
-        return content;
+        return phalcon_jsmin(content);
     }
 }
@@ -24,6 +24,16 @@ class Loader extends AbstractEventsAware
      */
     protected checkedPath = null;
 
+    /**
+     * @var array|null
+     */
+    protected classMap = null;
+
+    /**
+     * @var bool
+     */
+    protected classMapAuthoritative = false;
+
     /**
      * @var array
      */
@@ -196,6 +206,23 @@ class Loader extends AbstractEventsAware
 
         this->addDebug("Class: 404: " . className);
 
+        if (null !== this->classMap) {
+            if (true === this->autoloadCheckClassMap(className)) {
+                return true;
+            }
+
+            this->addDebug("Class map: 404: " . className);
+
+            /**
+             * An authoritative class map lists every class, nothing to scan
+             */
+            if (true === this->classMapAuthoritative) {
+                this->fireManagerEvent("loader:afterCheckClass", className);
+
+                return false;
+            }
+        }
+
         if (true === this->autoloadCheckNamespaces(className)) {
             return true;
         }
@@ -222,6 +249,87 @@ class Loader extends AbstractEventsAware
         return false;
     }
 
+    /**
+     * Scans the registered namespaces and directories and returns an index of
+     * every class with the file it is declared in. Classes are resolved in the
+     * same order as autoload() checks the namespaces, directories and
+     * extensions
+     *
+     * @return array<string, string>
+     */
+    public function buildClassMap() -> array
+    {
+        var directories, directory, namespaces, nsSeparator, prefix;
+        array classMap;
+
+        let classMap    = [],
+            nsSeparator = "\\",
+            namespaces  = this->namespaces;
+
+        for prefix, directories in namespaces {
+            let prefix = rtrim(prefix, nsSeparator) . nsSeparator;
+
+            for directory in directories {
+                let classMap = this->scanDirectory(classMap, directory, prefix);
+            }
+        }
+
+        let directories = this->directories;
+
+        for directory in directories {
+            let classMap = this->scanDirectory(classMap, directory, "");
+        }
+
+        return classMap;
+    }
+
+    /**
+     * Builds the class map and stores it in a PHP file, which can be loaded
+     * with loadClassMap(). The file is written to a temporary file first and
+     * renamed, so concurrent requests always include a complete file
+     *
+     * ```php
+     * // bin/classmap.php, run after every deployment
+     * $loader->dumpClassMap("/app/cache/classmap.php");
+     * ```
+     *
+     * @param string $file
+     *
+     * @return array<string, string>
+     * @throws Exception
+     */
+    public function dumpClassMap(string file) -> array
+    {
+        var classMap, temporary;
+
+        let classMap  = this->buildClassMap(),
+            temporary = file . "." . uniqid("", true) . ".tmp";
+
+        if (
+            false === file_put_contents(
+                temporary,
+                "<?php return " . var_export(classMap, true) . ";\n"
+            ) ||
+            false === rename(temporary, file)
+        ) {
+            if (file_exists(temporary)) {
+                unlink(temporary);
+            }
+
+            throw new Exception(
+                "The class map file '" . file . "' cannot be written"
+            );
+        }
+
+        if (function_exists("opcache_invalidate")) {
+            opcache_invalidate(file, true);
+        }
+
+        let this->classMap = classMap;
+
+        return classMap;
+    }
+
     /**
      * Get the path the loader is checking for a path
      *
@@ -232,6 +340,16 @@ class Loader extends AbstractEventsAware
         return this->checkedPath;
     }
 
+    /**
+     * Returns the class map loaded with loadClassMap() or dumpClassMap()
+     *
+     * @return string[]|null
+     */
+    public function getClassMap() -> array | null
+    {
+        return this->classMap;
+    }
+
     /**
      * Returns the class-map currently registered in the autoloader
      *
@@ -302,6 +420,54 @@ class Loader extends AbstractEventsAware
         return this->namespaces;
     }
 
+    /**
+     * Loads a class map file created with dumpClassMap(). The file is built
+     * when it does not exist. Classes in the map are loaded with a single
+     * lookup, without checking the namespaces and directories. When the map
+     * is authoritative, classes missing from it are not searched for at all
+     *
+     * ```php
+     * $loader
+     *     ->setNamespaces(
+     *         [
+     *             "App" => "/app/src/",
+     *         ]
+     *     )
+     *     ->loadClassMap("/app/cache/classmap.php", true)
+     *     ->register();
+     * ```
+     *
+     * @param string $file
+     * @param bool   $authoritative
+     *
+     * @return Loader
+     * @throws Exception
+     */
+    public function loadClassMap(string file, bool authoritative = false) -> <Loader>
+    {
+        var classMap;
+
+        let this->classMapAuthoritative = authoritative;
+
+        if (true !== file_exists(file)) {
+            this->dumpClassMap(file);
+
+            return this;
+        }
+
+        let classMap = require file;
+
+        if (typeof classMap !== "array") {
+            throw new Exception(
+                "The class map file '" . file . "' does not return an array"
+            );
+        }
+
+        let this->classMap = classMap;
+
+        return this;
+    }
+
     /**
      * Checks if a file exists and then adds the file by doing virtual require
      */
@@ -594,6 +760,31 @@ class Loader extends AbstractEventsAware
         return this;
     }
 
+    /**
+     * Checks the loaded class map to find the class. Includes the file if
+     * found and returns true; false otherwise. The index is trusted, so the
+     * file is not checked for existence
+     *
+     * @param string $className
+     *
+     * @return bool
+     */
+    private function autoloadCheckClassMap(string className) -> bool
+    {
+        var filePath;
+
+        if fetch filePath, this->classMap[className] {
+            this->fireManagerEvent("loader:pathFound", filePath);
+            this->addDebug("Class map: load: " . filePath);
+
+            require_once filePath;
+
+            return true;
+        }
+
+        return false;
+    }
+
     /**
      * Checks the registered classes to find the class. Includes the file if
      * found and returns true; false otherwise
@@ -740,4 +931,78 @@ class Loader extends AbstractEventsAware
 
         return results;
     }
+
+    /**
+     * Adds the classes found in a directory to the class map. Classes already
+     * in the map are kept, and the registered extensions are preferred in the
+     * order autoload() checks them
+     *
+     * @param array  $classMap
+     * @param string $directory
+     * @param string $prefix
+     *
+     * @return array<string, string>
+     */
+    private function scanDirectory(
+        array classMap,
+        string directory,
+        string prefix
+    ) -> array {
+        var className, dirSeparator, extension, extensions, file, files,
+            filePath, found, relative, scanner;
+        array candidates;
+
+        let dirSeparator = DIRECTORY_SEPARATOR,
+            directory    = rtrim(directory, dirSeparator) . dirSeparator,
+            extensions   = this->extensions,
+            candidates   = [];
+
+        if (true !== is_dir(directory)) {
+            return classMap;
+        }
+
+        let scanner = new \RecursiveIteratorIterator(
+            new \RecursiveDirectoryIterator(
+                directory,
+                \FilesystemIterator::SKIP_DOTS
+            )
+        );
+
+        for file in iterator(scanner) {
+            if (true !== file->isFile()) {
+                continue;
+            }
+
+            let extension = file->getExtension();
+
+            if (true !== in_array(extension, extensions, true)) {
+                continue;
+            }
+
+            let filePath  = file->getPathname(),
+                relative  = substr(
+                    filePath,
+                    strlen(directory),
+                    -1 - strlen(extension)
+                ),
+                className = prefix . str_replace(dirSeparator, "\\", relative),
+                candidates[className][extension] = filePath;
+        }
+
+        for className, files in candidates {
+            if (true === isset(classMap[className])) {
+                continue;
+            }
+
+            for extension in extensions {
+                if fetch found, files[extension] {
+                    let classMap[className] = found;
+
+                    break;
+                }
+            }
+        }
+
+        return classMap;
+    }
 }
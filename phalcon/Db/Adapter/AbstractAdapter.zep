@@ -10,6 +10,7 @@
 
 namespace Phalcon\Db\Adapter;
 
+use Phalcon\Db\Dialect;
 use Phalcon\Db\DialectInterface;
 use Phalcon\Db\ColumnInterface;
 use Phalcon\Db\Enum;
@@ -976,6 +977,103 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->insert(table, values, fields, dataTypes);
     }
 
+    /**
+     * Inserts several rows into a table using multi-row INSERT statements.
+     * The rows are split in chunks so that no statement binds more
+     * placeholders than the dialect allows, each chunk is prepared and bound
+     * once. Returns the number of affected rows of every chunk executed, or
+     * false if a chunk fails
+     *
+     * ```php
+     * // Inserting three robots
+     * $affectedRows = $connection->insertBatch(
+     *     "robots",
+     *     [
+     *         ["Astro Boy", 1952],
+     *         ["Robby", 1956],
+     *         ["Bender", 1999],
+     *     ],
+     *     ["name", "year"]
+     * );
+     *
+     * // Next SQL sentence is sent to the database system
+     * INSERT INTO `robots` (`name`, `year`) VALUES (?, ?), (?, ?), (?, ?);
+     * ```
+     */
+    public function insertBatch(string table, array! rows, var fields = null, var dataTypes = null) -> array | bool
+    {
+        return this->doInsertBatch(table, rows, fields, dataTypes);
+    }
+
+    /**
+     * Inserts several rows into a table using multi-row INSERT statements.
+     * The fields are taken from the keys of the first row, every other row
+     * must have the same keys
+     *
+     * ```php
+     * // Inserting two robots
+     * $affectedRows = $connection->insertBatchAsDict(
+     *     "robots",
+     *     [
+     *         [
+     *             "name" => "Astro Boy",
+     *             "year" => 1952,
+     *         ],
+     *         [
+     *             "name" => "Robby",
+     *             "year" => 1956,
+     *         ],
+     *     ]
+     * );
+     *
+     * // Next SQL sentence is sent to the database system
+     * INSERT INTO `robots` (`name`, `year`) VALUES (?, ?), (?, ?);
+     * ```
+     */
+    public function insertBatchAsDict(string table, array! data, var dataTypes = null) -> array | bool
+    {
+        var field, fields, row, rows, values;
+
+        if empty data {
+            return false;
+        }
+
+        let rows   = [],
+            fields = null;
+
+        for row in data {
+            if unlikely typeof row != "array" || empty row {
+                throw new Exception(
+                    "Unable to insert into " . table . " without data"
+                );
+            }
+
+            if fields === null {
+                let fields = array_keys(row);
+            } elseif unlikely count(row) != count(fields) {
+                throw new Exception(
+                    "All the rows inserted into " . table . " must have the same fields"
+                );
+            }
+
+            let values = [];
+
+            for field in fields {
+                if unlikely !array_key_exists(field, row) {
+                    throw new Exception(
+                        "All the rows inserted into " . table . " must have the same fields"
+                    );
+                }
+
+                let values[] = row[field];
+            }
+
+            let rows[] = values;
+        }
+
+        return this->insertBatch(table, rows, fields, dataTypes);
+    }
+
     /**
      * Returns if nested transactions should use savepoints
      */
@@ -1408,6 +1506,52 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->update(table, fields, values, whereCondition, dataTypes);
     }
 
+    /**
+     * Inserts several rows into a table or updates the rows that clash with
+     * them on the conflict fields, using multi-row INSERT statements with the
+     * upsert clause of the dialect. By default every field which is not a
+     * conflict field is updated. Returns the number of affected rows of
+     * every chunk executed, as reported by the database system
+     *
+     * ```php
+     * $affectedRows = $connection->upsertBatch(
+     *     "robots",
+     *     [
+     *         [1, "Astro Boy", 1952],
+     *         [2, "Robby", 1956],
+     *     ],
+     *     ["id", "name", "year"],
+     *     ["id"]
+     * );
+     *
+     * // Next SQL sentence is sent to the database system
+     * INSERT INTO `robots` (`id`, `name`, `year`) VALUES (?, ?, ?), (?, ?, ?)
+     * ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`);
+     * ```
+     */
+    public function upsertBatch(string table, array! rows, array! fields, array! conflictFields, var updateFields = null, var dataTypes = null) -> array | bool
+    {
+        var field;
+
+        if typeof updateFields != "array" {
+            let updateFields = [];
+
+            for field in fields {
+                if !in_array(field, conflictFields) {
+                    let updateFields[] = field;
+                }
+            }
+        }
+
+        return this->doInsertBatch(
+            table,
+            rows,
+            fields,
+            dataTypes,
+            [conflictFields, updateFields]
+        );
+    }
+
     /**
      * Check whether the database system requires an explicit value for identity
      * columns
@@ -1440,4 +1584,195 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
     {
         return this->fetchOne(this->dialect->viewExists(viewName, schemaName), Enum::FETCH_NUM)[0] > 0;
     }
+
+    /**
+     * Inserts the rows in chunks that fit the placeholder limit of the
+     * dialect. When upsert is an array with the conflict and update fields,
+     * every chunk is turned into an upsert by the dialect
+     */
+    protected function doInsertBatch(string table, array rows, var fields, var dataTypes, var upsert = null) -> array | bool
+    {
+        var affected, affectedRows, bindDataTypes, bindType, columns,
+            escapedFields, escapedTable, field, insertSql, insertValues,
+            maxPlaceholders, placeholders, position, row, rowBindTypes,
+            rowValues, tableName, value, values;
+        int bound;
+
+        if unlikely !count(rows) {
+            throw new Exception(
+                "Unable to insert into " . table . " without data"
+            );
+        }
+
+        if strpos(table, ".") > 0 {
+            let tableName = explode(".", table);
+        } else {
+            let tableName = table;
+        }
+
+        let escapedTable = this->escapeIdentifier(tableName);
+
+        if typeof fields == "array" {
+            let escapedFields = [];
+
+            for field in fields {
+                let escapedFields[] = this->escapeIdentifier(field);
+            }
+
+            let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES ";
+        } else {
+            let insertSql = "INSERT INTO " . escapedTable . " VALUES ";
+        }
+
+        /**
+         * Dialects not extending Phalcon\Db\Dialect get the lowest limit of
+         * the bundled ones
+         */
+        if this->dialect instanceof Dialect {
+            let maxPlaceholders = this->dialect->getMaxPlaceholders();
+        } else {
+            let maxPlaceholders = 999;
+        }
+
+        let affectedRows    = [],
+            values          = [],
+            insertValues    = [],
+            bindDataTypes   = [],
+            columns         = null,
+            bound           = 0;
+
+        for row in rows {
+            if unlikely typeof row != "array" || !count(row) {
+                throw new Exception(
+                    "Unable to insert into " . table . " without data"
+                );
+            }
+
+            if columns === null {
+                let columns = count(row);
+            } elseif unlikely count(row) != columns {
+                throw new Exception(
+                    "All the rows inserted into " . table . " must have the same number of values"
+                );
+            }
+
+            let placeholders = [],
+                rowValues    = [],
+                rowBindTypes = [];
+
+            /**
+             * Values are handled the same way insert() does
+             */
+            for position, value in row {
+                if typeof value == "object" && value instanceof RawValue {
+                    let placeholders[] = (string) value;
+                } else {
+                    if typeof value == "object" {
+                        let value = (string) value;
+                    }
+
+                    if value === null {
+                        let placeholders[] = "null";
+                    } else {
+                        let placeholders[] = "?";
+                        let rowValues[] = value;
+
+                        if typeof dataTypes == "array" {
+                            if unlikely !fetch bindType, dataTypes[position] {
+                                throw new Exception(
+                                    "Incomplete number of bind types"
+                                );
+                            }
+
+                            let rowBindTypes[] = bindType;
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Flush the current chunk if this row does not fit in it
+             */
+            if bound > 0 && bound + count(rowValues) > maxPlaceholders {
+                let affected = this->executeInsertBatch(
+                    insertSql,
+                    values,
+                    insertValues,
+                    bindDataTypes,
+                    upsert
+                );
+
+                if affected === false {
+                    return false;
+                }
+
+                let affectedRows[] = affected,
+                    values         = [],
+                    insertValues   = [],
+                    bindDataTypes  = [],
+                    bound          = 0;
+            }
+
+            let values[]      = "(" . join(", ", placeholders) . ")",
+                insertValues  = array_merge(insertValues, rowValues),
+                bindDataTypes = array_merge(bindDataTypes, rowBindTypes),
+                bound         += count(rowValues);
+        }
+
+        let affected = this->executeInsertBatch(
+            insertSql,
+            values,
+            insertValues,
+            bindDataTypes,
+            upsert
+        );
+
+        if affected === false {
+            return false;
+        }
+
+        let affectedRows[] = affected;
+
+        return affectedRows;
+    }
+
+    /**
+     * Returns the INSERT SQL turned into an upsert by the dialect
+     */
+    protected function getUpsertSql(string insertSql, array conflictFields, array updateFields) -> string
+    {
+        if unlikely !(this->dialect instanceof Dialect) {
+            throw new Exception(
+                "The dialect of the connection does not support upserts"
+            );
+        }
+
+        return this->dialect->upsert(insertSql, conflictFields, updateFields);
+    }
+
+    /**
+     * Executes one chunk of a multi-row INSERT and returns its affected rows
+     */
+    protected function executeInsertBatch(string insertSql, array values, array insertValues, array bindDataTypes, var upsert = null) -> int | bool
+    {
+        var success;
+
+        let insertSql = insertSql . join(", ", values);
+
+        if typeof upsert == "array" {
+            let insertSql = this->getUpsertSql(insertSql, upsert[0], upsert[1]);
+        }
+
+        if !count(bindDataTypes) {
+            let success = this->{"execute"}(insertSql, insertValues);
+        } else {
+            let success = this->{"execute"}(insertSql, insertValues, bindDataTypes);
+        }
+
+        if !success {
+            return false;
+        }
+
+        return this->{"affectedRows"}();
+    }
 }
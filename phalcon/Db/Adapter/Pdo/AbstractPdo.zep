@@ -34,6 +34,10 @@ use Phalcon\Events\ManagerInterface;
  *
  * $connection = new Mysql($config);
  *```
+ *
+ * The `statementCacheSize` option of the descriptor keeps up to that many
+ * prepared statements per connection, keyed by their SQL text, so that
+ * `query()` and `execute()` prepare the same statement only once
  */
 abstract class AbstractPdo extends AbstractAdapter
 {
@@ -51,6 +55,43 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     protected pdo;
 
+    /**
+     * Prepared statements, keyed by SQL text, from the least to the most
+     * recently used
+     *
+     * @var array
+     */
+    protected statementCache = [];
+
+    /**
+     * @var int
+     */
+    protected statementCacheEvictions = 0;
+
+    /**
+     * @var int
+     */
+    protected statementCacheHits = 0;
+
+    /**
+     * @var int
+     */
+    protected statementCacheMisses = 0;
+
+    /**
+     * Weak references to the results returned for the cached statements
+     *
+     * @var array
+     */
+    protected statementCacheResults = [];
+
+    /**
+     * Maximum number of cached prepared statements (0 disables the cache)
+     *
+     * @var int
+     */
+    protected statementCacheSize = 0;
+
     /**
      * Constructor for Phalcon\Db\Adapter\Pdo
      *
@@ -63,7 +104,8 @@ abstract class AbstractPdo extends AbstractAdapter
      *     'dialectClass' => null,
      *     'options' => [],
      *     'dsn' => null,
-     *     'charset' => 'utf8mb4'
+     *     'charset' => 'utf8mb4',
+     *     'statementCacheSize' => 0
      * ]
      */
     public function __construct(array! descriptor)
@@ -206,9 +248,20 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function close() -> void
     {
+        this->clearStatementCache();
+
         let this->pdo = null;
     }
 
+    /**
+     * Removes all the cached prepared statements
+     */
+    public function clearStatementCache() -> void
+    {
+        let this->statementCache = [],
+            this->statementCacheResults = [];
+    }
+
     /**
      * This method is automatically called in \Phalcon\Db\Adapter\Pdo
      * constructor.
@@ -236,11 +289,30 @@ abstract class AbstractPdo extends AbstractAdapter
     public function connect(array! descriptor = []) -> void
     {
         var username, password, dsnAttributes, dsnAttributesCustomRaw,
-            dsnAttributesMap, key, options, persistent, value;
+            dsnAttributesMap, key, options, persistent, value,
+            statementCacheSize;
         array dsnParts = [];
 
         if empty descriptor {
             let descriptor = this->descriptor;
+
+            /**
+             * Reconnecting keeps the size set by setStatementCacheSize()
+             */
+            unset descriptor["statementCacheSize"];
+        }
+
+        /**
+         * Statements prepared with a previous handler cannot be reused
+         */
+        this->clearStatementCache();
+
+        // Check for the size of the prepared statement cache. It must not
+        // become a dsn setting.
+        if fetch statementCacheSize, descriptor["statementCacheSize"] {
+            let this->statementCacheSize = (int) statementCacheSize;
+
+            unset descriptor["statementCacheSize"];
         }
 
         // Check for a username or use null as default
@@ -423,7 +495,7 @@ abstract class AbstractPdo extends AbstractAdapter
         this->prepareRealSql(sqlStatement, bindParams);
 
         if !empty bindParams {
-            let statement = this->pdo->prepare(sqlStatement);
+            let statement = this->prepareCached(sqlStatement);
 
             if typeof statement == "object" {
                 let newStatement = this->executePrepared(
@@ -585,6 +657,36 @@ abstract class AbstractPdo extends AbstractAdapter
         return this->pdo;
     }
 
+    /**
+     * Returns the maximum number of cached prepared statements
+     */
+    public function getStatementCacheSize() -> int
+    {
+        return this->statementCacheSize;
+    }
+
+    /**
+     * Returns the counters of the prepared statement cache
+     *
+     * @return array = [
+     *     'capacity' => 0,
+     *     'size' => 0,
+     *     'hits' => 0,
+     *     'misses' => 0,
+     *     'evictions' => 0
+     * ]
+     */
+    public function getStatementCacheStats() -> array
+    {
+        return [
+            "capacity":  this->statementCacheSize,
+            "size":      count(this->statementCache),
+            "hits":      this->statementCacheHits,
+            "misses":    this->statementCacheMisses,
+            "evictions": this->statementCacheEvictions
+        ];
+    }
+
     /**
      * Returns the current transaction nesting level
      */
@@ -687,58 +789,32 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function query(string! sqlStatement, array! bindParams = [], array! bindTypes = []) -> <ResultInterface> | bool
     {
-        var eventsManager, statement, params, types;
-
-        let eventsManager = <ManagerInterface> this->eventsManager;
-
-        /**
-         * Execute the beforeQuery event if an EventsManager is available
-         */
-        if typeof eventsManager == "object" {
-            let this->sqlStatement = sqlStatement,
-                this->sqlVariables = bindParams,
-                this->sqlBindTypes = bindTypes;
-
-            if eventsManager->fire("db:beforeQuery", this) === false {
-                return false;
-            }
-        }
-
-        if !empty bindParams {
-            let params = bindParams;
-            let types = bindTypes;
-        } else {
-            let params = [];
-            let types = [];
-        }
-
-        let statement = this->pdo->prepare(sqlStatement);
-        if unlikely typeof statement != "object" {
-            throw new Exception("Cannot prepare statement");
-        }
-
-        this->prepareRealSql(sqlStatement, bindParams);
-
-        let statement = this->executePrepared(statement, params, types);
-
-        /**
-         * Execute the afterQuery event if an EventsManager is available
-         */
-        if typeof statement == "object" {
-            if typeof eventsManager == "object" {
-                eventsManager->fire("db:afterQuery", this);
-            }
-
-            return new PdoResult(
-                this,
-                statement,
-                sqlStatement,
-                bindParams,
-                bindTypes
-            );
-        }
+        return this->executeQuery(sqlStatement, bindParams, bindTypes, false);
+    }
 
-        return statement;
+    /**
+     * Sends a SELECT statement to the database server returning a result
+     * whose rows are read from the server as they are fetched, instead of
+     * being buffered in memory. MySQL runs the statement as an unbuffered
+     * query and PostgreSQL through a server-side cursor.
+     *
+     * The result can only be traversed forward and, on MySQL, no other
+     * statement can be sent through the connection until all its rows are
+     * read
+     *
+     *```php
+     * $result = $connection->queryStream(
+     *     "SELECT * FROM robots"
+     * );
+     *
+     * while ($robot = $result->fetch()) {
+     *     echo $robot["name"];
+     * }
+     *```
+     */
+    public function queryStream(string! sqlStatement, array! bindParams = [], array! bindTypes = []) -> <ResultInterface> | bool
+    {
+        return this->executeQuery(sqlStatement, bindParams, bindTypes, true);
     }
 
     /**
@@ -804,11 +880,185 @@ abstract class AbstractPdo extends AbstractAdapter
         return this->rollbackSavepoint(savepointName);
     }
 
+    /**
+     * Sets the maximum number of cached prepared statements. The least
+     * recently used statements above the new size are removed
+     */
+    public function setStatementCacheSize(int size) -> <AbstractPdo>
+    {
+        let this->statementCacheSize = size;
+
+        while count(this->statementCache) > 0 && count(this->statementCache) > size {
+            this->evictStatement();
+        }
+
+        return this;
+    }
+
+    /**
+     * Removes the least recently used prepared statement from the cache
+     */
+    protected function evictStatement() -> void
+    {
+        var sqlStatement;
+
+        let sqlStatement = array_key_first(this->statementCache);
+
+        unset this->statementCache[sqlStatement];
+        unset this->statementCacheResults[sqlStatement];
+
+        let this->statementCacheEvictions++;
+    }
+
+    /**
+     * Prepares and executes a statement returning rows, firing the query
+     * events
+     */
+    protected function executeQuery(string! sqlStatement, array! bindParams, array! bindTypes, bool stream) -> <ResultInterface> | bool
+    {
+        var eventsManager, statement, params, types, result, cachedStatement;
+
+        let eventsManager = <ManagerInterface> this->eventsManager;
+
+        /**
+         * Execute the beforeQuery event if an EventsManager is available
+         */
+        if typeof eventsManager == "object" {
+            let this->sqlStatement = sqlStatement,
+                this->sqlVariables = bindParams,
+                this->sqlBindTypes = bindTypes;
+
+            if eventsManager->fire("db:beforeQuery", this) === false {
+                return false;
+            }
+        }
+
+        if !empty bindParams {
+            let params = bindParams;
+            let types = bindTypes;
+        } else {
+            let params = [];
+            let types = [];
+        }
+
+        /**
+         * Streamed statements are not cached, they stay in use until all
+         * their rows are read
+         */
+        if stream {
+            let statement = this->prepareStream(sqlStatement);
+        } else {
+            let statement = this->prepareCached(sqlStatement);
+        }
+
+        if unlikely typeof statement != "object" {
+            throw new Exception("Cannot prepare statement");
+        }
+
+        this->prepareRealSql(sqlStatement, bindParams);
+
+        if stream {
+            let statement = this->executeStream(statement, params, types);
+        } else {
+            let statement = this->executePrepared(statement, params, types);
+        }
+
+        /**
+         * Execute the afterQuery event if an EventsManager is available
+         */
+        if typeof statement == "object" {
+            if typeof eventsManager == "object" {
+                eventsManager->fire("db:afterQuery", this);
+            }
+
+            let result = new PdoResult(
+                this,
+                statement,
+                sqlStatement,
+                bindParams,
+                bindTypes
+            );
+
+            /**
+             * The cached statement cannot be executed again while the result
+             * is in use
+             */
+            if fetch cachedStatement, this->statementCache[sqlStatement] {
+                if cachedStatement === statement {
+                    let this->statementCacheResults[sqlStatement] = \WeakReference::create(result);
+                }
+            }
+
+            return result;
+        }
+
+        return statement;
+    }
+
+    /**
+     * Executes a statement prepared by prepareStream()
+     */
+    protected function executeStream(<\PDOStatement> statement, array! placeholders, dataTypes) -> <\PDOStatement>
+    {
+        return this->executePrepared(statement, placeholders, dataTypes);
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
     abstract protected function getDsnDefaults() -> array;
 
+    /**
+     * Returns a prepared statement for the SQL text, reusing the cached one
+     * when it is not used by a live result
+     */
+    protected function prepareCached(string sqlStatement) -> <\PDOStatement> | bool
+    {
+        var statement, result;
+
+        if this->statementCacheSize < 1 {
+            return this->pdo->prepare(sqlStatement);
+        }
+
+        if fetch statement, this->statementCache[sqlStatement] {
+            if fetch result, this->statementCacheResults[sqlStatement] {
+                if result->get() !== null {
+                    let this->statementCacheMisses++;
+
+                    return this->pdo->prepare(sqlStatement);
+                }
+
+                unset this->statementCacheResults[sqlStatement];
+            }
+
+            /**
+             * Move the statement to the most recently used position
+             */
+            unset this->statementCache[sqlStatement];
+
+            let this->statementCache[sqlStatement] = statement;
+            let this->statementCacheHits++;
+
+            statement->closeCursor();
+
+            return statement;
+        }
+
+        let this->statementCacheMisses++;
+
+        let statement = this->pdo->prepare(sqlStatement);
+
+        if typeof statement == "object" {
+            if count(this->statementCache) >= this->statementCacheSize {
+                this->evictStatement();
+            }
+
+            let this->statementCache[sqlStatement] = statement;
+        }
+
+        return statement;
+    }
+
     /**
      * Constructs the SQL statement (with parameters)
      *
@@ -846,4 +1096,13 @@ abstract class AbstractPdo extends AbstractAdapter
 
         let this->realSqlStatement = result;
     }
+
+    /**
+     * Prepares a statement whose rows are read from the server as they are
+     * fetched
+     */
+    protected function prepareStream(string sqlStatement) -> <\PDOStatement> | bool
+    {
+        return this->pdo->prepare(sqlStatement);
+    }
 }
@@ -13,12 +13,14 @@ namespace Phalcon\Db\Adapter\Pdo;
 use Phalcon\Db\Adapter\Pdo\AbstractPdo as PdoAdapter;
 use Phalcon\Db\Column;
 use Phalcon\Db\ColumnInterface;
+use Phalcon\Db\Dialect\Mysql as MysqlDialect;
 use Phalcon\Db\Enum;
 use Phalcon\Db\Exception;
 use Phalcon\Db\Index;
 use Phalcon\Db\IndexInterface;
 use Phalcon\Db\Reference;
 use Phalcon\Db\ReferenceInterface;
+use Throwable;
 
 /**
  * Specific functions for the MySQL database system
@@ -592,6 +594,32 @@ class Mysql extends PdoAdapter
         return referenceObjects;
     }
 
+    /**
+     * Executes the statement as an unbuffered query, so its rows are sent by
+     * the server as they are fetched. The buffering of the connection is
+     * restored once the statement is executed
+     */
+    protected function executeStream(<\PDOStatement> statement, array! placeholders, dataTypes) -> <\PDOStatement>
+    {
+        var buffered, exception;
+
+        let buffered = this->pdo->getAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY);
+
+        this->pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, false);
+
+        try {
+            let statement = this->executePrepared(statement, placeholders, dataTypes);
+        } catch Throwable, exception {
+            this->pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+
+            throw exception;
+        }
+
+        this->pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+
+        return statement;
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
@@ -602,4 +630,27 @@ class Mysql extends PdoAdapter
             "charset" : "utf8mb4"
         ];
     }
+
+    /**
+     * Returns the INSERT SQL turned into an upsert by the dialect. MySQL
+     * 8.0.19 and later reference the inserted values through a row alias,
+     * MariaDB and older servers through VALUES()
+     */
+    protected function getUpsertSql(string insertSql, array conflictFields, array updateFields) -> string
+    {
+        var version;
+
+        if !(this->dialect instanceof MysqlDialect) {
+            return parent::getUpsertSql(insertSql, conflictFields, updateFields);
+        }
+
+        let version = (string) this->pdo->getAttribute(\PDO::ATTR_SERVER_VERSION);
+
+        return this->dialect->upsert(
+            insertSql,
+            conflictFields,
+            updateFields,
+            stripos(version, "mariadb") === false && version_compare(version, "8.0.19", ">=")
+        );
+    }
 }
@@ -688,4 +688,22 @@ class Postgresql extends PdoAdapter
     {
         return [];
     }
+
+    /**
+     * Prepares the statement with a forward-only cursor and without
+     * prefetching, so pdo_pgsql reads the rows in single-row mode as they are
+     * fetched instead of buffering the whole result. A scrollable cursor
+     * would cost a FETCH round-trip per row. Before PHP 8.4 pdo_pgsql ignores
+     * the prefetch attribute and buffers the result
+     */
+    protected function prepareStream(string sqlStatement) -> <\PDOStatement> | bool
+    {
+        return this->pdo->prepare(
+            sqlStatement,
+            [
+                \PDO::ATTR_CURSOR   : \PDO::CURSOR_FWDONLY,
+                \PDO::ATTR_PREFETCH : 0
+            ]
+        );
+    }
 }
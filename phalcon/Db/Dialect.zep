@@ -26,6 +26,11 @@ abstract class Dialect implements DialectInterface
      */
     protected customFunctions = [];
 
+    /**
+     * @var int
+     */
+    protected maxPlaceholders = 999;
+
     /**
      * Generate SQL to create a new savepoint
      */
@@ -136,6 +141,14 @@ abstract class Dialect implements DialectInterface
         return this->customFunctions;
     }
 
+    /**
+     * Returns the maximum number of placeholders a single statement can bind
+     */
+    public function getMaxPlaceholders() -> int
+    {
+        return this->maxPlaceholders;
+    }
+
     /**
      * Resolve Column expressions
      *
@@ -585,6 +598,49 @@ abstract class Dialect implements DialectInterface
         return this->supportsSavePoints();
     }
 
+    /**
+     * Returns an INSERT SQL modified to update the existing rows when the
+     * conflict fields clash, using an ON CONFLICT clause. If no update fields
+     * are passed the conflicting rows are left as they are
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * // INSERT INTO robots (id, name) VALUES (?, ?)
+     * // ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+     * echo $sql;
+     *```
+     */
+    public function upsert(string! sqlQuery, array! conflictFields, array! updateFields) -> string
+    {
+        var field, conflicts, updates;
+
+        if unlikely !count(conflictFields) {
+            throw new Exception("At least one conflict field is required");
+        }
+
+        let conflicts = [],
+            updates   = [];
+
+        for field in conflictFields {
+            let conflicts[] = this->escape(field);
+        }
+
+        if !count(updateFields) {
+            return sqlQuery . " ON CONFLICT (" . join(", ", conflicts) . ") DO NOTHING";
+        }
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = EXCLUDED." . this->escape(field);
+        }
+
+        return sqlQuery . " ON CONFLICT (" . join(", ", conflicts) . ") DO UPDATE SET " . join(", ", updates);
+    }
+
     /**
      * Returns the size of the column enclosed in parentheses
      */
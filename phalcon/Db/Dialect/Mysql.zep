@@ -28,6 +28,13 @@ class Mysql extends Dialect
      */
     protected escapeChar = "`";
 
+    /**
+     * Placeholders allowed per statement, the client/server protocol stores the number of parameters in 16 bits
+     *
+     * @var int
+     */
+    protected maxPlaceholders = 65535;
+
     /**
      * Generates SQL to add a column to a table
      */
@@ -823,6 +830,66 @@ class Mysql extends Dialect
         return "TRUNCATE TABLE " . table;
     }
 
+    /**
+     * Returns an INSERT SQL modified to update the existing rows on duplicate
+     * keys. MySQL picks the conflicting key by itself, the conflict fields
+     * are only used to leave the rows as they are when there is nothing to
+     * update. With rowAlias the inserted values are referenced through a row
+     * alias, as required by MySQL 8.0.20 and later where VALUES() is
+     * deprecated
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * // INSERT INTO robots (id, name) VALUES (?, ?)
+     * // ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)
+     * echo $sql;
+     *
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"],
+     *     true
+     * );
+     *
+     * // INSERT INTO robots (id, name) VALUES (?, ?) AS `new`
+     * // ON DUPLICATE KEY UPDATE `name` = `new`.`name`
+     * echo $sql;
+     *```
+     */
+    public function upsert(string! sqlQuery, array! conflictFields, array! updateFields, bool rowAlias = false) -> string
+    {
+        var field, updates;
+
+        let updates = [];
+
+        if !count(updateFields) {
+            if unlikely !fetch field, conflictFields[0] {
+                throw new Exception("At least one conflict field is required");
+            }
+
+            return sqlQuery . " ON DUPLICATE KEY UPDATE " . this->escape(field) . " = " . this->escape(field);
+        }
+
+        if rowAlias {
+            for field in updateFields {
+                let updates[] = this->escape(field) . " = `new`." . this->escape(field);
+            }
+
+            return sqlQuery . " AS `new` ON DUPLICATE KEY UPDATE " . join(", ", updates);
+        }
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = VALUES(" . this->escape(field) . ")";
+        }
+
+        return sqlQuery . " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
@@ -28,6 +28,13 @@ class Postgresql extends Dialect
      */
     protected escapeChar = "\"";
 
+    /**
+     * Placeholders allowed per statement, the frontend/backend protocol stores the number of parameters in 16 bits
+     *
+     * @var int
+     */
+    protected maxPlaceholders = 65535;
+
     /**
      * Generates SQL to add a column to a table
      */
@@ -28,6 +28,13 @@ class Sqlite extends Dialect
      */
     protected escapeChar = "\"";
 
+    /**
+     * Placeholders allowed per statement, SQLITE_MAX_VARIABLE_NUMBER defaults to 999 before SQLite 3.32.0
+     *
+     * @var int
+     */
+    protected maxPlaceholders = 999;
+
     /**
      * Generates SQL to add a column to a table
      */
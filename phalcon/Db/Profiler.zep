@@ -10,7 +10,9 @@
 
 namespace Phalcon\Db;
 
+use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Db\Profiler\Item;
+use Phalcon\Events\EventInterface;
 
 /**
  * Instances of Phalcon\Db can generate execution profiles
@@ -46,6 +48,10 @@ use Phalcon\Db\Profiler\Item;
  * // Set the event manager on the connection
  * $connection->setEventsManager($eventsManager);
  *
+ * // Or attach the profiler itself, which also collects the counters of
+ * // the prepared statement cache of the connection after every query
+ * $eventsManager->attach("db", $profiler);
+ *
  *
  * $sql = "SELECT buyer_name, quantity, product_name
  * FROM buyers LEFT JOIN products ON
@@ -79,6 +85,13 @@ class Profiler
      */
     protected allProfiles;
 
+    /**
+     * Prepared statement cache counters reported by the connection
+     *
+     * @var array
+     */
+    protected statementCacheStats = [];
+
     /**
      * Total time spent by all profiles to complete in nanoseconds
      *
@@ -86,6 +99,33 @@ class Profiler
      */
     protected totalNanoseconds = 0;
 
+    /**
+     * Stops the active profile and records the counters of the prepared
+     * statement cache of the connection, when the profiler is attached to the
+     * "db" events
+     */
+    public function afterQuery(<EventInterface> event, <AdapterInterface> connection) -> void
+    {
+        this->stopProfile();
+
+        if method_exists(connection, "getStatementCacheStats") {
+            let this->statementCacheStats = connection->{"getStatementCacheStats"}();
+        }
+    }
+
+    /**
+     * Starts a profile of the statement of the connection, when the profiler
+     * is attached to the "db" events
+     */
+    public function beforeQuery(<EventInterface> event, <AdapterInterface> connection) -> void
+    {
+        this->startProfile(
+            connection->getSQLStatement(),
+            connection->getSQLVariables(),
+            connection->getSQLBindTypes()
+        );
+    }
+
     /**
      * Returns the last profile executed in the profiler
      */
@@ -102,6 +142,79 @@ class Profiler
         return count(this->allProfiles);
     }
 
+    /**
+     * Returns the number of evicted prepared statements reported by the
+     * connection
+     */
+    public function getStatementCacheEvictions() -> int
+    {
+        var evictions;
+
+        if fetch evictions, this->statementCacheStats["evictions"] {
+            return evictions;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the maximum number of cached prepared statements reported by
+     * the connection
+     */
+    public function getStatementCacheCapacity() -> int
+    {
+        var capacity;
+
+        if fetch capacity, this->statementCacheStats["capacity"] {
+            return capacity;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the number of prepared statements reused from the cache of the
+     * connection
+     */
+    public function getStatementCacheHits() -> int
+    {
+        var hits;
+
+        if fetch hits, this->statementCacheStats["hits"] {
+            return hits;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the number of statements that had to be prepared
+     */
+    public function getStatementCacheMisses() -> int
+    {
+        var misses;
+
+        if fetch misses, this->statementCacheStats["misses"] {
+            return misses;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the number of prepared statements cached by the connection
+     */
+    public function getStatementCacheSize() -> int
+    {
+        var size;
+
+        if fetch size, this->statementCacheStats["size"] {
+            return size;
+        }
+
+        return 0;
+    }
+
     /**
      * Returns the total time in nanoseconds spent by the profiles
      */
@@ -139,7 +252,32 @@ class Profiler
      */
     public function reset() -> <Profiler>
     {
-        let this->allProfiles = [];
+        let this->allProfiles = [],
+            this->statementCacheStats = [];
+
+        return this;
+    }
+
+    /**
+     * Records the counters of the prepared statement cache of the connection
+     *
+     *```php
+     * $profiler->setStatementCacheStats(
+     *     $connection->getStatementCacheStats()
+     * );
+     *```
+     *
+     * @param array statementCacheStats = [
+     *     'capacity' => 0,
+     *     'size' => 0,
+     *     'hits' => 0,
+     *     'misses' => 0,
+     *     'evictions' => 0
+     * ]
+     */
+    public function setStatementCacheStats(array statementCacheStats) -> <Profiler>
+    {
+        let this->statementCacheStats = statementCacheStats;
 
         return this;
     }
@@ -22,6 +22,7 @@ use Phalcon\Events\ManagerInterface;
 use Phalcon\Di\InitializationAwareInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Di\ServiceProviderInterface;
+use Phalcon\Di\Service\Compiler;
 
 /**
  * Phalcon\Di\Di is a component that implements Dependency Injection/Service
@@ -63,6 +64,20 @@ use Phalcon\Di\ServiceProviderInterface;
  */
 class Di implements DiInterface
 {
+    /**
+     * Class of the compiled container loaded with loadCompiled()
+     *
+     * @var string|null
+     */
+    protected compiled = null;
+
+    /**
+     * Services built by the compiled container, with their shared flag
+     *
+     * @var array
+     */
+    protected compiledServices = [];
+
     /**
      * List of registered services
      *
@@ -115,7 +130,7 @@ class Di implements DiInterface
         if starts_with(method, "get") {
             let possibleService = lcfirst(substr(method, 3));
 
-            if isset this->services[possibleService] {
+            if this->has(possibleService) {
                 let instance = this->get(possibleService, arguments);
 
                 return instance;
@@ -154,7 +169,7 @@ class Di implements DiInterface
      */
     public function attempt(string! name, definition, bool shared = false) -> <ServiceInterface> | bool
     {
-        if isset this->services[name] {
+        if this->has(name) {
             return false;
         }
 
@@ -163,6 +178,84 @@ class Di implements DiInterface
         return this->services[name];
     }
 
+    /**
+     * Generates a PHP class that builds the registered services with direct
+     * `new` calls and resolved constructor, setter and property injection.
+     * Services defined with a class name or an array definition are compiled,
+     * closures and objects are not. The class is loaded with loadCompiled()
+     *
+     * ```php
+     * $di->loadFromYaml("path/services.yaml");
+     * $di->compile("cache/container.php", "App\\CompiledContainer");
+     * ```
+     */
+    public function compile(string! filePath, string! className) -> void
+    {
+        var compiler, definition, name, namespaceName, service, services,
+            shortName, position, code, temporary;
+        array cases, definitions, shared;
+
+        let compiler    = new Compiler(),
+            cases       = [],
+            definitions = [],
+            shared      = [],
+            services    = this->getServices();
+
+        for name, service in services {
+            let definition = service->getDefinition(),
+                code       = compiler->compile(definition);
+
+            if code === null {
+                continue;
+            }
+
+            let definitions[name] = definition,
+                shared[name]      = service->isShared(),
+                cases[]           = "            case " . var_export(name, true) . ":\n" .
+                    "                " . str_replace("\n", "\n                ", code) . "\n" .
+                    "                return $instance;";
+        }
+
+        let className     = ltrim(className, "\\"),
+            position      = strrpos(className, "\\"),
+            namespaceName = "",
+            shortName     = className;
+
+        if position !== false {
+            let namespaceName = "namespace " . substr(className, 0, position) . ";\n\n",
+                shortName     = substr(className, position + 1);
+        }
+
+        let code = "<?php\n\n" .
+            "/**\n * Generated by Phalcon\\Di\\Di::compile()\n */\n\n" .
+            namespaceName .
+            "final class " . shortName . "\n{\n" .
+            "    public const DEFINITIONS = " . var_export(definitions, true) . ";\n\n" .
+            "    public const SERVICES = " . var_export(shared, true) . ";\n\n" .
+            "    public static function build(\\Phalcon\\Di\\DiInterface $container, string $name)\n    {\n" .
+            "        switch ($name) {\n" .
+            implode("\n\n", cases) . "\n" .
+            "        }\n\n" .
+            "        return null;\n" .
+            "    }\n}\n";
+
+        let temporary = filePath . "." . uniqid("", true) . ".tmp";
+
+        if false === file_put_contents(temporary, code) || false === rename(temporary, filePath) {
+            if file_exists(temporary) {
+                unlink(temporary);
+            }
+
+            throw new Exception(
+                "The compiled container cannot be written to '" . filePath . "'"
+            );
+        }
+
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(filePath, true);
+        }
+    }
+
     /**
      * Resolves the service based on its configuration
      */
@@ -170,6 +263,18 @@ class Di implements DiInterface
     {
         var service, isShared, instance = null;
 
+        /**
+         * Compiled services are built by the compiled container, unless
+         * parameters override their definition
+         */
+        if !isset this->services[name] && isset this->compiledServices[name] {
+            if parameters === null {
+                return this->getCompiled(name);
+            }
+
+            this->getService(name);
+        }
+
         /**
          * If the service is shared and it already has a cached instance then
          * immediately return it without triggering events.
@@ -285,15 +390,7 @@ class Di implements DiInterface
      */
     public function getRaw(string! name) -> var
     {
-        var service;
-
-        if unlikely !fetch service, this->services[name] {
-            throw new Exception(
-                "Service '" . name . "' was not found in the dependency injection container"
-            );
-        }
-
-        return service->getDefinition();
+        return this->getService(name)->getDefinition();
     }
 
     /**
@@ -301,14 +398,28 @@ class Di implements DiInterface
      */
     public function getService(string! name) -> <ServiceInterface>
     {
-        var service;
+        var definitions, service, shared;
 
-        if unlikely !fetch service, this->services[name] {
+        if fetch service, this->services[name] {
+            return service;
+        }
+
+        /**
+         * A compiled service is registered as a regular one when its
+         * definition is needed
+         */
+        if unlikely !fetch shared, this->compiledServices[name] {
             throw new Exception(
                 "Service '" . name . "' was not found in the dependency injection container"
             );
         }
 
+        let definitions = constant(this->compiled . "::DEFINITIONS"),
+            service     = new Service(definitions[name], shared),
+            this->services[name] = service;
+
+        unset this->compiledServices[name];
+
         return service;
     }
 
@@ -317,6 +428,14 @@ class Di implements DiInterface
      */
     public function getServices() -> <ServiceInterface[]>
     {
+        var name, shared, compiledServices;
+
+        let compiledServices = this->compiledServices;
+
+        for name, shared in compiledServices {
+            this->getService(name);
+        }
+
         return this->services;
     }
 
@@ -340,6 +459,67 @@ class Di implements DiInterface
         return instance;
     }
 
+    /**
+     * Builds a service with the compiled container
+     */
+    protected function getCompiled(string! name) -> var
+    {
+        var className, instance = null;
+        bool isShared;
+
+        let isShared = (bool) this->compiledServices[name];
+
+        if isShared && fetch instance, this->sharedInstances[name] {
+            return instance;
+        }
+
+        if this->eventsManager !== null {
+            let instance = this->eventsManager->fire(
+                "di:beforeServiceResolve",
+                this,
+                [
+                    "name":       name,
+                    "parameters": null
+                ]
+            );
+        }
+
+        if instance === null {
+            let className = this->compiled,
+                instance  = {className}::build(this, name);
+
+            if isShared {
+                let this->sharedInstances[name] = instance;
+            }
+        } elseif typeof instance === "object" {
+            /**
+             * The compiled code injects the container in the instances it
+             * builds, those of the event are handled as get() does
+             */
+            if instance instanceof InjectionAwareInterface {
+                instance->setDI(this);
+            }
+
+            if instance instanceof InitializationAwareInterface {
+                instance->initialize();
+            }
+        }
+
+        if this->eventsManager !== null {
+            this->eventsManager->fire(
+                "di:afterServiceResolve",
+                this,
+                [
+                    "name":       name,
+                    "parameters": null,
+                    "instance":   instance
+                ]
+            );
+        }
+
+        return instance;
+    }
+
     /**
      * Loads services from a Config object.
      */
@@ -446,7 +626,47 @@ class Di implements DiInterface
      */
     public function has(string! name) -> bool
     {
-        return isset this->services[name];
+        return isset this->services[name] || isset this->compiledServices[name];
+    }
+
+    /**
+     * Loads a container generated with compile(). Its services are built
+     * without resolving their definitions. Services already registered are
+     * kept instead of the compiled ones, and services registered afterwards
+     * replace them
+     *
+     * ```php
+     * $di->loadCompiled("cache/container.php", "App\\CompiledContainer");
+     * ```
+     */
+    public function loadCompiled(string! filePath, string! className) -> void
+    {
+        var compiledServices, name;
+
+        if !class_exists(className, false) {
+            if unlikely !file_exists(filePath) {
+                throw new Exception(
+                    "The compiled container '" . filePath . "' was not found"
+                );
+            }
+
+            require_once filePath;
+        }
+
+        if unlikely !class_exists(className, false) {
+            throw new Exception(
+                "The compiled container class '" . className . "' was not found"
+            );
+        }
+
+        let compiledServices = constant(className . "::SERVICES");
+
+        for name, _ in this->services {
+            unset compiledServices[name];
+        }
+
+        let this->compiled         = className,
+            this->compiledServices = compiledServices;
     }
 
     /**
@@ -530,6 +750,8 @@ class Di implements DiInterface
         let sharedInstances = this->sharedInstances;
         unset sharedInstances[name];
         let this->sharedInstances = sharedInstances;
+
+        unset this->compiledServices[name];
     }
 
     /**
@@ -545,6 +767,8 @@ class Di implements DiInterface
      */
     public function set(string! name, var definition, bool shared = false) -> <ServiceInterface>
     {
+        unset this->compiledServices[name];
+
         let this->services[name] = new Service(definition, shared);
 
         return this->services[name];
@@ -572,6 +796,8 @@ class Di implements DiInterface
      */
     public function setService(string! name, <ServiceInterface> rawDefinition) -> <ServiceInterface>
     {
+        unset this->compiledServices[name];
+
         let this->services[name] = rawDefinition;
 
         return rawDefinition;
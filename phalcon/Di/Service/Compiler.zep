@@ -0,0 +1,251 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Di\Service;
+
+use Phalcon\Di\Exception;
+
+/**
+ * Phalcon\Di\Service\Compiler
+ *
+ * This class generates the PHP code that builds instances based on class
+ * name and complex definitions, the same way Phalcon\Di\Service\Builder does
+ */
+class Compiler
+{
+    /**
+     * Returns the PHP statements that build a service definition into
+     * `$instance`, or null when the definition cannot be compiled, such as
+     * closures and already built objects
+     *
+     * @param mixed definition
+     */
+    public function compile(var definition) -> string | null
+    {
+        var className, arguments, paramCalls, methodPosition, method,
+            methodName, propertyPosition, property, propertyName,
+            propertyValue;
+        array code;
+
+        if typeof definition === "string" {
+            if !class_exists(definition) {
+                return null;
+            }
+
+            let definition = ["className": definition];
+        }
+
+        if typeof definition !== "array" || !this->isExportable(definition) {
+            return null;
+        }
+
+        /**
+         * The class name is required
+         */
+        if unlikely !fetch className, definition["className"] {
+            throw new Exception(
+                "Invalid service definition. Missing 'className' parameter"
+            );
+        }
+
+        let code = [];
+
+        /**
+         * Check if the argument has constructor arguments
+         */
+        if fetch arguments, definition["arguments"] {
+            let code[] = "$instance = new \\" . ltrim(className, "\\") . "(" .
+                this->compileParameters(arguments) . ");";
+        } else {
+            let code[] = "$instance = new \\" . ltrim(className, "\\") . "();";
+        }
+
+        /**
+         * The definition has calls?
+         */
+        if fetch paramCalls, definition["calls"] {
+            if unlikely typeof paramCalls != "array" {
+                throw new Exception(
+                    "Setter injection parameters must be an array"
+                );
+            }
+
+            for methodPosition, method in paramCalls {
+                if unlikely typeof method != "array" {
+                    throw new Exception(
+                        "Method call must be an array on position " . methodPosition
+                    );
+                }
+
+                if unlikely !fetch methodName, method["method"] {
+                    throw new Exception(
+                        "The method name is required on position " . methodPosition
+                    );
+                }
+
+                if fetch arguments, method["arguments"] {
+                    if unlikely typeof arguments != "array" {
+                        throw new Exception(
+                            "Call arguments must be an array on position " .
+                            (string) methodPosition
+                        );
+                    }
+                } else {
+                    let arguments = [];
+                }
+
+                let code[] = "$instance->{" . var_export(methodName, true) . "}(" .
+                    this->compileParameters(arguments) . ");";
+            }
+        }
+
+        /**
+         * The definition has properties?
+         */
+        if fetch paramCalls, definition["properties"] {
+            if unlikely typeof paramCalls !== "array" {
+                throw new Exception(
+                    "Setter injection parameters must be an array"
+                );
+            }
+
+            for propertyPosition, property in paramCalls {
+                if unlikely typeof property != "array" {
+                    throw new Exception(
+                        "Property must be an array on position " . propertyPosition
+                    );
+                }
+
+                if unlikely !fetch propertyName, property["name"] {
+                    throw new Exception(
+                        "The property name is required on position " . propertyPosition
+                    );
+                }
+
+                if unlikely !fetch propertyValue, property["value"] {
+                    throw new Exception(
+                        "The property value is required on position " . propertyPosition
+                    );
+                }
+
+                let code[] = "$instance->{" . var_export(propertyName, true) . "} = " .
+                    this->compileParameter(propertyPosition, propertyValue) . ";";
+            }
+        }
+
+        /**
+         * The container is passed while compiling, not on every resolution
+         */
+        if is_a(className, "Phalcon\\Di\\InjectionAwareInterface", true) {
+            let code[] = "$instance->setDI($container);";
+        }
+
+        if is_a(className, "Phalcon\\Di\\InitializationAwareInterface", true) {
+            let code[] = "$instance->initialize();";
+        }
+
+        return implode("\n", code);
+    }
+
+    /**
+     * Whether the definition only holds values that var_export() can restore
+     *
+     * @param mixed value
+     */
+    private function isExportable(var value) -> bool
+    {
+        var element;
+
+        if typeof value === "array" {
+            for element in value {
+                if !this->isExportable(element) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        return value === null || is_scalar(value);
+    }
+
+    /**
+     * Returns the code resolving a constructor/call parameter
+     */
+    private function compileParameter(int position, array! argument) -> string
+    {
+        var type, name, value, instanceArguments;
+
+        /**
+         * All the arguments must have a type
+         */
+        if unlikely !fetch type, argument["type"] {
+            throw new Exception(
+                "Argument at position " . position . " must have a type"
+            );
+        }
+
+        switch type {
+            case "service":
+                if unlikely !fetch name, argument["name"] {
+                    throw new Exception(
+                        "Service 'name' is required in parameter on position " . position
+                    );
+                }
+
+                return "$container->get(" . var_export(name, true) . ")";
+
+            case "parameter":
+                if unlikely !fetch value, argument["value"] {
+                    throw new Exception(
+                        "Service 'value' is required in parameter on position " . position
+                    );
+                }
+
+                return var_export(value, true);
+
+            case "instance":
+                if unlikely !fetch name, argument["className"] {
+                    throw new Exception(
+                        "Service 'className' is required in parameter on position " . position
+                    );
+                }
+
+                if fetch instanceArguments, argument["arguments"] {
+                    return "$container->get(" . var_export(name, true) . ", " .
+                        var_export(instanceArguments, true) . ")";
+                }
+
+                return "$container->get(" . var_export(name, true) . ")";
+
+            default:
+                throw new Exception(
+                    "Unknown service type in parameter on position " . position
+                );
+        }
+    }
+
+    /**
+     * Returns the code resolving an array of parameters
+     */
+    private function compileParameters(array! arguments) -> string
+    {
+        var position, argument;
+        array parameters;
+
+        let parameters = [];
+
+        for position, argument in arguments {
+            let parameters[] = this->compileParameter(position, argument);
+        }
+
+        return implode(", ", parameters);
+    }
+}
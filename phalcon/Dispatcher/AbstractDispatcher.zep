@@ -20,6 +20,8 @@ use Phalcon\Filter\FilterInterface;
 use Phalcon\Mvc\Model\Binder;
 use Phalcon\Mvc\Model\BinderInterface;
 use Phalcon\Support\Collection;
+use Phalcon\Support\Helper\File\MergeExported;
+use ReflectionClass;
 
 /**
  * This is the base class for Phalcon\Mvc\Dispatcher and Phalcon\Cli\Dispatcher.
@@ -148,11 +150,59 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
      */
     protected previousNamespaceName = "";
 
+    /**
+     * @var array|null
+     */
+    protected resolutionCache = null;
+
+    /**
+     * @var string|null
+     */
+    protected resolutionCacheFile = null;
+
+    /**
+     * Resolutions added since the resolution cache file was last written
+     *
+     * @var array
+     */
+    protected resolutionCachePending = [];
+
+    /**
+     * Whether cached resolutions are checked against the modification time
+     * of the file of the handler class
+     *
+     * @var bool
+     */
+    protected resolutionCacheStat = true;
+
+    /**
+     * @var bool
+     */
+    protected resolutionCaching = false;
+
     /**
      * @var string|null
      */
     protected returnedValue = null;
 
+    /**
+     * Writes the handlers and actions resolved during the request to the
+     * resolution cache file
+     */
+    public function __destruct()
+    {
+        var e;
+
+        /**
+         * A destructor cannot throw, the failure is reported as an error
+         */
+        try {
+            this->flushResolutionCache();
+        } catch PhalconException, e {
+            trigger_error(e->getMessage());
+        }
+    }
+
     public function callActionMethod(handler, string actionMethod, array! params = [])
     {
         var result, observer, altHandler, altAction, altParams;
@@ -203,6 +253,31 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return result;
     }
 
+    /**
+     * Removes the resolved handlers and actions from memory and deletes the
+     * resolution cache file
+     *
+     * ```php
+     * $dispatcher->clearResolutionCache();
+     * ```
+     */
+    public function clearResolutionCache() -> void
+    {
+        var cacheFile;
+
+        let this->resolutionCache        = null,
+            this->resolutionCachePending = [],
+            cacheFile                    = this->resolutionCacheFile;
+
+        if cacheFile !== null && file_exists(cacheFile) {
+            unlink(cacheFile);
+
+            if function_exists("opcache_invalidate") {
+                opcache_invalidate(cacheFile, true);
+            }
+        }
+    }
+
     /**
      * Process the results of the router by calling into the appropriate
      * controller action(s) including any routing data or injected parameters.
@@ -219,7 +294,9 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         int numberDispatches;
         var value, handler, container, namespaceName, handlerName, actionName,
             eventsManager, handlerClass, status, actionMethod,
-            modelBinder, bindCacheKey, isNewHandler, handlerHash, e;
+            modelBinder, bindCacheKey, isNewHandler, handlerHash, e,
+            resolutionCache, resolutionKey, resolution, hooks, bindingPlan,
+            handlerFile;
 
         let container = <DiInterface> this->container;
 
@@ -313,19 +390,41 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            let handlerClass = this->getHandlerClass();
-
             /**
-             * Handlers are retrieved as shared instances from the Service
-             * Container
+             * Reuse the handler class, action method and hooks resolved for
+             * the same namespace, handler and action
              */
-            let hasService = (bool) container->has(handlerClass);
-            if !hasService {
+            let resolution = null;
+
+            if this->resolutionCaching {
+                this->resolveEmptyProperties();
+
+                let resolutionKey   = this->getResolutionCacheKey(),
+                    resolutionCache = this->getResolutionCache();
+
+                if !fetch resolution, resolutionCache[resolutionKey] {
+                    let resolution = null;
+                }
+            }
+
+            if resolution !== null {
+                let handlerClass = resolution["class"],
+                    hasService   = true;
+            } else {
+                let handlerClass = this->getHandlerClass();
+
                 /**
-                 * DI doesn't have a service with that name, try to load it
-                 * using an autoloader
+                 * Handlers are retrieved as shared instances from the Service
+                 * Container
                  */
-                let hasService = class_exists(handlerClass);
+                let hasService = (bool) container->has(handlerClass);
+                if !hasService {
+                    /**
+                     * DI doesn't have a service with that name, try to load it
+                     * using an autoloader
+                     */
+                    let hasService = class_exists(handlerClass);
+                }
             }
 
             // If the service can be loaded we throw an exception
@@ -358,6 +457,16 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 break;
             }
 
+            /**
+             * The container may return another class for the same service,
+             * and the class may have been deployed again since it was cached
+             */
+            if resolution !== null {
+                if get_class(handler) !== resolution["handler"] || (this->resolutionCacheStat && !this->isResolutionCurrent(resolution)) {
+                    let resolution = null;
+                }
+            }
+
             // Check if the handler is new (hasn't been initialized).
             let handlerHash = spl_object_hash(handler);
 
@@ -393,33 +502,54 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             }
 
             // Check if the method exists in the handler
-            let actionMethod = this->getActiveMethod();
+            if resolution !== null {
+                let actionMethod = resolution["method"],
+                    hooks        = resolution["hooks"];
+            } else {
+                let actionMethod = this->getActiveMethod();
+
+                if unlikely !is_callable([handler, actionMethod]) {
+                    if hasEventsManager {
+                        if eventsManager->fire("dispatch:beforeNotFoundAction", this) === false {
+                            continue;
+                        }
 
-            if unlikely !is_callable([handler, actionMethod]) {
-                if hasEventsManager {
-                    if eventsManager->fire("dispatch:beforeNotFoundAction", this) === false {
-                        continue;
+                        if this->finished === false {
+                            continue;
+                        }
                     }
 
-                    if this->finished === false {
+                    /**
+                     * Try to throw an exception when an action isn't defined on the
+                     * object
+                     */
+                    let status = this->{"throwDispatchException"}(
+                        "Action '" . actionName . "' was not found on handler '" . handlerName . "'",
+                        PhalconException::EXCEPTION_ACTION_NOT_FOUND
+                    );
+
+                    if status === false && this->finished === false {
                         continue;
                     }
+
+                    break;
                 }
 
-                /**
-                 * Try to throw an exception when an action isn't defined on the
-                 * object
-                 */
-                let status = this->{"throwDispatchException"}(
-                    "Action '" . actionName . "' was not found on handler '" . handlerName . "'",
-                    PhalconException::EXCEPTION_ACTION_NOT_FOUND
-                );
+                let hooks = this->getHandlerHooks(handler);
 
-                if status === false && this->finished === false {
-                    continue;
-                }
+                if this->resolutionCaching {
+                    let handlerFile = this->getHandlerFile(handler),
+                        resolution  = [
+                            "class"   : handlerClass,
+                            "handler" : get_class(handler),
+                            "method"  : actionMethod,
+                            "hooks"   : hooks,
+                            "file"    : handlerFile,
+                            "mtime"   : handlerFile === null ? null : filemtime(handlerFile)
+                        ];
 
-                break;
+                    this->addResolutionCache(resolutionKey, resolution);
+                }
             }
 
             /**
@@ -452,7 +582,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            if method_exists(handler, "beforeExecuteRoute") {
+            if hooks["beforeExecuteRoute"] {
                 try {
                     // Calling "beforeExecuteRoute" as direct method
                     if handler->beforeExecuteRoute(this) === false || this->finished === false {
@@ -489,7 +619,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
              * @see https://github.com/phalcon/cphalcon/pull/13112
              */
             if isNewHandler {
-                if method_exists(handler, "initialize") {
+                if hooks["initialize"] {
                     try {
                         let this->isControllerInitialize = true;
 
@@ -537,12 +667,32 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 let modelBinder = this->modelBinder;
                 let bindCacheKey = "_PHMB_" . handlerClass . "_" . actionMethod;
 
+                /**
+                 * Bind with the cached plan instead of reflecting on the
+                 * action parameters
+                 */
+                if resolution !== null && modelBinder instanceof Binder {
+                    if fetch bindingPlan, resolution["binding"] {
+                        modelBinder->setBindingPlan(bindCacheKey, bindingPlan);
+                    }
+                }
+
                 let this->params = modelBinder->bindToHandler(
                     handler,
                     this->params,
                     bindCacheKey,
                     actionMethod
                 );
+
+                if resolution !== null && modelBinder instanceof Binder && !isset resolution["binding"] {
+                    let bindingPlan = modelBinder->getBindingPlan(bindCacheKey);
+
+                    if bindingPlan !== null {
+                        let resolution["binding"] = bindingPlan;
+
+                        this->addResolutionCache(resolutionKey, resolution);
+                    }
+                }
             }
 
             /**
@@ -564,7 +714,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling afterBinding as callback and event
              */
-            if method_exists(handler, "afterBinding") {
+            if hooks["afterBinding"] {
                 if handler->afterBinding(this) === false {
                     continue;
                 }
@@ -623,7 +773,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling "afterExecuteRoute" as direct method
              */
-            if method_exists(handler, "afterExecuteRoute") {
+            if hooks["afterExecuteRoute"] {
                 try {
                     if handler->afterExecuteRoute(this, value) === false || this->finished === false {
                         continue;
@@ -674,6 +824,56 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return handler;
     }
 
+    /**
+     * Adds the handlers and actions resolved since the last call to the
+     * resolution cache file. The file is reloaded while holding an exclusive
+     * lock on a sidecar ".lock" file, so the resolutions written by other
+     * workers are kept, and is only replaced when some resolutions changed
+     *
+     * ```php
+     * $dispatcher->flushResolutionCache();
+     * ```
+     */
+    public function flushResolutionCache() -> void
+    {
+        var cacheFile, cached, pending;
+
+        let cacheFile = this->resolutionCacheFile;
+
+        if cacheFile === null || count(this->resolutionCachePending) === 0 {
+            return;
+        }
+
+        let pending                      = this->resolutionCachePending,
+            this->resolutionCachePending = [];
+
+        let cached = (new MergeExported())->__invoke(
+            cacheFile,
+            function (cached) use (pending) {
+                var resolution, resolutionKey;
+
+                for resolutionKey, resolution in pending {
+                    if !isset cached[resolutionKey] || cached[resolutionKey] !== resolution {
+                        let cached[resolutionKey] = resolution;
+                    }
+                }
+
+                return cached;
+            }
+        );
+
+        if unlikely false === cached {
+            throw new PhalconException(
+                "The dispatcher resolution cache file '" . cacheFile . "' cannot be written"
+            );
+        }
+
+        /**
+         * Keep the resolutions of the other workers as well
+         */
+        let this->resolutionCache = cached;
+    }
+
     /**
      * Forwards the execution flow to another controller/action.
      *
@@ -938,6 +1138,14 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->finished;
     }
 
+    /**
+     * Whether the resolved handlers and actions are cached
+     */
+    public function isResolutionCaching() -> bool
+    {
+        return this->resolutionCaching;
+    }
+
     /**
      * Sets the action name to be dispatched
      */
@@ -1119,6 +1327,32 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         let this->namespaceName = namespaceName;
     }
 
+    /**
+     * Caches the handler class, action method, model binding plan and handler
+     * hooks resolved for every namespace, handler and action, so later
+     * dispatches skip the class and method lookups. With `stat`, a
+     * resolution is dropped when the file of the handler class is modified,
+     * which costs a stat of that file on every dispatch; disable it when the
+     * handlers are only deployed along with a cleared cache. With a file,
+     * the cache is kept in a generated PHP file shared by the following
+     * requests through opcache, written by flushResolutionCache() or when
+     * the dispatcher is destroyed
+     *
+     * ```php
+     * $dispatcher->setResolutionCache(true, "../app/cache/dispatcher.php", false);
+     * ```
+     */
+    public function setResolutionCache(bool resolutionCaching, string resolutionCacheFile = null, bool stat = true) -> void
+    {
+        this->flushResolutionCache();
+
+        let this->resolutionCaching      = resolutionCaching,
+            this->resolutionCacheFile    = resolutionCacheFile,
+            this->resolutionCacheStat    = stat,
+            this->resolutionCache        = null,
+            this->resolutionCachePending = [];
+    }
+
     /**
      * Returns value returned by the latest dispatched action
      */
@@ -1135,6 +1369,43 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->forwarded;
     }
 
+    /**
+     * Returns the resolved handlers and actions, loading the resolution cache
+     * file on first use
+     */
+    protected function getResolutionCache() -> array
+    {
+        var cacheFile, resolutionCache;
+
+        if this->resolutionCache === null {
+            let resolutionCache = [],
+                cacheFile       = this->resolutionCacheFile;
+
+            if cacheFile !== null && file_exists(cacheFile) {
+                let resolutionCache = require cacheFile;
+
+                if typeof resolutionCache !== "array" {
+                    let resolutionCache = [];
+                }
+            }
+
+            let this->resolutionCache = resolutionCache;
+        }
+
+        return this->resolutionCache;
+    }
+
+    /**
+     * Returns the key of the current namespace, handler and action in the
+     * resolution cache
+     */
+    protected function getResolutionCacheKey() -> string
+    {
+        return get_class(this) . "|" . this->namespaceName . "|" .
+            this->handlerName . "|" . this->handlerSuffix . "|" .
+            this->actionName . "|" . this->actionSuffix;
+    }
+
     /**
      * Set empty properties to their defaults (where defaults are available)
      */
@@ -1174,4 +1445,72 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
 
         return camelCaseInput;
     }
+
+    /**
+     * Adds a resolved handler and action to the cache, written to the
+     * resolution cache file by flushResolutionCache()
+     */
+    private function addResolutionCache(string! resolutionKey, array! resolution) -> void
+    {
+        this->getResolutionCache();
+
+        let this->resolutionCache[resolutionKey] = resolution;
+
+        if this->resolutionCacheFile !== null {
+            let this->resolutionCachePending[resolutionKey] = resolution;
+        }
+    }
+
+    /**
+     * Returns the file declaring the class of the handler, or null for
+     * classes not declared in a file
+     */
+    private function getHandlerFile(object handler) -> string | null
+    {
+        var file, reflection;
+
+        let reflection = new ReflectionClass(handler),
+            file       = reflection->getFileName();
+
+        if typeof file !== "string" {
+            return null;
+        }
+
+        return file;
+    }
+
+    /**
+     * Returns which of the methods called around the action the handler has
+     */
+    private function getHandlerHooks(object handler) -> array
+    {
+        return [
+            "afterBinding"       : method_exists(handler, "afterBinding"),
+            "afterExecuteRoute"  : method_exists(handler, "afterExecuteRoute"),
+            "beforeExecuteRoute" : method_exists(handler, "beforeExecuteRoute"),
+            "initialize"         : method_exists(handler, "initialize")
+        ];
+    }
+
+    /**
+     * Whether the file of the handler class is unchanged since the handler
+     * and action were resolved, so its hooks and action are still the same
+     */
+    private function isResolutionCurrent(array! resolution) -> bool
+    {
+        var file, mtime;
+
+        if !array_key_exists("file", resolution) || !array_key_exists("mtime", resolution) {
+            return false;
+        }
+
+        let file  = resolution["file"],
+            mtime = resolution["mtime"];
+
+        if file === null {
+            return true;
+        }
+
+        return file_exists(file) && filemtime(file) === mtime;
+    }
 }
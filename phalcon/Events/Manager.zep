@@ -38,6 +38,22 @@ class Manager implements ManagerInterface
      */
     protected events = [];
 
+    /**
+     * Whether the handler classes implement a method, keyed by class and
+     * event name
+     *
+     * @var array
+     */
+    protected handlerMethods = [];
+
+    /**
+     * Handlers of every event type sorted by priority, rebuilt from the
+     * queues after they change
+     *
+     * @var array
+     */
+    protected listeners = [];
+
     /**
      * @var array
      */
@@ -75,6 +91,8 @@ class Manager implements ManagerInterface
 
         // Insert the handler in the queue
         priorityQueue->insert(handler, priority);
+
+        unset this->listeners[eventType];
     }
 
     /**
@@ -138,6 +156,8 @@ class Manager implements ManagerInterface
             }
 
             let this->events[eventType] = newPriorityQueue;
+
+            unset this->listeners[eventType];
         }
     }
 
@@ -147,11 +167,14 @@ class Manager implements ManagerInterface
     public function detachAll(string! type = null) -> void
     {
         if type === null {
-            let this->events = null;
+            let this->events    = null,
+                this->listeners = [];
         } else {
             if isset this->events[type] {
                 unset this->events[type];
             }
+
+            unset this->listeners[type];
         }
     }
 
@@ -185,47 +208,48 @@ class Manager implements ManagerInterface
      */
     public function fire(string! eventType, object source, var data = null, bool cancelable = true)
     {
-        var events, eventParts, type, eventName, event, status, fireEvents;
+        var position, type, eventName, event, status, typeListeners,
+            eventListeners;
 
-        let events = this->events;
-
-        if empty events {
+        if empty this->events {
             return null;
         }
 
         // All valid events must have a colon separator
-        if unlikely !memstr(eventType, ":") {
+        let position = strpos(eventType, ":");
+
+        if unlikely false === position {
             throw new Exception("Invalid event type " . eventType);
         }
 
-        let eventParts = explode(":", eventType),
-            type = eventParts[0],
-            eventName = eventParts[1];
-
-        let status = null;
-
         // Responses must be traced?
         if this->collect {
             let this->responses = [];
         }
 
+        let type           = substr(eventType, 0, position),
+            typeListeners  = this->getSortedListeners(type),
+            eventListeners = this->getSortedListeners(eventType);
+
+        // Nothing to notify, the event is not created
+        if empty typeListeners && empty eventListeners {
+            return null;
+        }
+
+        let status    = null,
+            eventName = strstr(substr(eventType, position + 1) . ":", ":", true);
+
         // Create the event context
         let event = new Event(eventName, source, data, cancelable);
 
         // Check if events are grouped by type
-        if fetch fireEvents, events[type] {
-            if typeof fireEvents == "object" {
-                // Call the events queue
-                let status = this->fireQueue(fireEvents, event);
-            }
+        if !empty typeListeners {
+            let status = this->fireListeners(typeListeners, event);
         }
 
         // Check if there are listeners for the event type itself
-        if fetch fireEvents, events[eventType] {
-            if typeof fireEvents == "object" {
-                // Call the events queue
-                let status = this->fireQueue(fireEvents, event);
-            }
+        if !empty eventListeners {
+            let status = this->fireListeners(eventListeners, event);
         }
 
         return status;
@@ -238,29 +262,10 @@ class Manager implements ManagerInterface
      */
     final public function fireQueue(<SplPriorityQueue> queue, <EventInterface> event)
     {
-        var status, eventName, data, iterator, source, handler;
-        bool collect, cancelable;
-
-        let status = null;
-
-        // Get the event type
-        let eventName = event->getType();
-
-        if unlikely typeof eventName != "string" {
-            throw new Exception("The event type not valid");
-        }
-
-        // Get the object who triggered the event
-        let source = event->getSource();
-
-        // Get extra data passed to the event
-        let data = event->getData();
-
-        // Tell if the event is cancelable
-        let cancelable = (bool) event->isCancelable();
+        var handler, iterator;
+        array listeners;
 
-        // Responses need to be traced?
-        let collect = (bool) this->collect;
+        let listeners = [];
 
         // We need to clone the queue before iterate over it
         let iterator = clone queue;
@@ -279,36 +284,10 @@ class Manager implements ManagerInterface
                 continue;
             }
 
-            // Check if the event is a closure
-            if handler instanceof Closure || is_callable(handler) {
-                // Call the function in the PHP userland
-                let status = call_user_func_array(
-                    handler,
-                    [event, source, data]
-                );
-            } else {
-                // Check if the listener has implemented an event with the same name
-                if !method_exists(handler, eventName) {
-                    continue;
-                }
-
-                let status = handler->{eventName}(event, source, data);
-            }
-
-            // Trace the response
-            if collect {
-                let this->responses[] = status;
-            }
-
-            if cancelable {
-                // Check if the event was stopped by the user
-                if event->isStopped() {
-                    break;
-                }
-            }
+            let listeners[] = [handler, handler instanceof Closure || is_callable(handler)];
         }
 
-        return status;
+        return this->fireListeners(listeners, event);
     }
 
     /**
@@ -316,23 +295,14 @@ class Manager implements ManagerInterface
      */
     public function getListeners(string! type) -> array
     {
-        var fireEvents, priorityQueue;
+        var listener, sorted;
         array listeners;
 
-        if !fetch fireEvents, this->events[type] {
-            return [];
-        }
-
-        let listeners = [];
-
-        let priorityQueue = clone fireEvents;
-
-        priorityQueue->top();
+        let listeners = [],
+            sorted    = this->getSortedListeners(type);
 
-        while priorityQueue->valid() {
-            let listeners[] = priorityQueue->current();
-
-            priorityQueue->next();
+        for listener in sorted {
+            let listeners[] = listener[0];
         }
 
         return listeners;
@@ -372,4 +342,114 @@ class Manager implements ManagerInterface
 
         return true;
     }
+
+    /**
+     * Calls the listeners, pairs of handler and whether it is callable, until
+     * the event is stopped
+     *
+     * @return mixed
+     */
+    protected function fireListeners(array! listeners, <EventInterface> event)
+    {
+        var status, eventName, data, source, handler, listener, className,
+            exists;
+        bool collect, cancelable;
+
+        let status = null;
+
+        // Get the event type
+        let eventName = event->getType();
+
+        if unlikely typeof eventName != "string" {
+            throw new Exception("The event type not valid");
+        }
+
+        // Get the object who triggered the event
+        let source = event->getSource();
+
+        // Get extra data passed to the event
+        let data = event->getData();
+
+        // Tell if the event is cancelable
+        let cancelable = (bool) event->isCancelable();
+
+        // Responses need to be traced?
+        let collect = (bool) this->collect;
+
+        for listener in listeners {
+            let handler = listener[0];
+
+            // Check if the event is a closure
+            if listener[1] {
+                // Call the function in the PHP userland
+                let status = call_user_func_array(
+                    handler,
+                    [event, source, data]
+                );
+            } else {
+                // Check once per class if the listener has implemented an event with the same name
+                let className = get_class(handler);
+
+                if !fetch exists, this->handlerMethods[className][eventName] {
+                    let exists = method_exists(handler, eventName),
+                        this->handlerMethods[className][eventName] = exists;
+                }
+
+                if !exists {
+                    continue;
+                }
+
+                let status = handler->{eventName}(event, source, data);
+            }
+
+            // Trace the response
+            if collect {
+                let this->responses[] = status;
+            }
+
+            if cancelable {
+                // Check if the event was stopped by the user
+                if event->isStopped() {
+                    break;
+                }
+            }
+        }
+
+        return status;
+    }
+
+    /**
+     * Returns the listeners of an event type sorted by priority. The queue is
+     * only walked again after attach() or detach() changed it
+     */
+    protected function getSortedListeners(string! type) -> array
+    {
+        var handler, listeners, priorityQueue;
+
+        if fetch listeners, this->listeners[type] {
+            return listeners;
+        }
+
+        let listeners = [];
+
+        if fetch priorityQueue, this->events[type] {
+            if typeof priorityQueue == "object" {
+                let priorityQueue = clone priorityQueue;
+
+                priorityQueue->top();
+
+                while priorityQueue->valid() {
+                    let handler = priorityQueue->current();
+
+                    priorityQueue->next();
+
+                    let listeners[] = [handler, handler instanceof Closure || is_callable(handler)];
+                }
+            }
+        }
+
+        let this->listeners[type] = listeners;
+
+        return listeners;
+    }
 }
@@ -106,6 +106,17 @@ class Escaper implements EscaperInterface
      */
     public function css(string input) -> string
     {
+        var escaped;
+
+        /**
+         * UTF-8 is escaped as it is
+         */
+        let escaped = phalcon_escape_css_utf8(input);
+
+        if escaped !== null {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -253,12 +264,8 @@ class Escaper implements EscaperInterface
         if null === input {
             return "";
         }
-        return htmlspecialchars(
-            input,
-            this->flags,
-            this->encoding,
-            this->doubleEncode
-        );
+
+        return this->doEscapeHtml(input);
     }
 
     /**
@@ -271,6 +278,17 @@ class Escaper implements EscaperInterface
      */
     public function js(string input) -> string
     {
+        var escaped;
+
+        /**
+         * UTF-8 is escaped as it is
+         */
+        let escaped = phalcon_escape_js_utf8(input);
+
+        if escaped !== null {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -370,6 +388,14 @@ class Escaper implements EscaperInterface
      */
     public function url(string input) -> string
     {
+        var escaped;
+
+        let escaped = phalcon_escape_url(input);
+
+        if escaped !== null {
+            return escaped;
+        }
+
         return rawurlencode(input);
     }
 
@@ -382,12 +408,7 @@ class Escaper implements EscaperInterface
      */
     protected function phpHtmlSpecialChars(string input) -> string
     {
-        return htmlspecialchars(
-            input,
-            this->flags,
-            this->encoding,
-            this->doubleEncode
-        );
+        return this->doEscapeHtml(input);
     }
 
     /**
@@ -400,6 +421,38 @@ class Escaper implements EscaperInterface
         return phalcon_escape_css(input);
     }
 
+    /**
+     * Escapes UTF-8 natively, returning the input as it is when there is
+     * nothing to escape. Other encodings and options are left to
+     * htmlspecialchars
+     *
+     * @param string $input
+     *
+     * @return string
+     */
+    private function doEscapeHtml(string input) -> string
+    {
+        var escaped;
+
+        let escaped = phalcon_escape_html_utf8(
+            input,
+            this->flags,
+            this->encoding,
+            this->doubleEncode
+        );
+
+        if escaped !== null {
+            return escaped;
+        }
+
+        return htmlspecialchars(
+            input,
+            this->flags,
+            this->encoding,
+            this->doubleEncode
+        );
+    }
+
     /**
      * @param string $input
      *
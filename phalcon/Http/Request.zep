@@ -55,6 +55,25 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
      */
     private filterService = null;
 
+    /**
+     * Server names of the headers looked up, per header name
+     *
+     * @var array
+     */
+    private headerNames = [];
+
+    /**
+     * Headers parsed from the server array in headersServer
+     *
+     * @var array|null
+     */
+    private headers = null;
+
+    /**
+     * @var array|null
+     */
+    private headersServer = null;
+
     /**
      * @var bool
      */
@@ -75,6 +94,13 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
      */
     private putCache = null;
 
+    /**
+     * Quality headers parsed, per server index
+     *
+     * @var array
+     */
+    private qualityHeaders = [];
+
     /**
      * @var string
      */
@@ -375,19 +401,16 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
      */
     final public function getHeader(string! header) -> string
     {
-        var value, name, server;
-
-        let name = strtoupper(
-            strtr(header, "-", "_")
-        );
+        var value, names, server;
 
-        let server = this->getServerArray();
+        let names  = this->getHeaderNames(header),
+            server = this->getServerArray();
 
-        if fetch value, server[name] {
+        if fetch value, server[names[0]] {
             return value;
         }
 
-        if fetch value, server["HTTP_" . name] {
+        if fetch value, server[names[1]] {
             return value;
         }
 
@@ -422,48 +445,54 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
 
         let server = this->getServerArray();
 
-        for name, value in server {
-            // Note: The starts_with uses case insensitive search here
-            if starts_with(name, "HTTP_") {
-                let name = ucwords(
-                    strtolower(
-                        str_replace(
-                            "_",
-                            " ",
-                            substr(name, 5)
+        /**
+         * The headers are parsed again only when the server array changed
+         */
+        if this->headers === null || server !== this->headersServer {
+            for name, value in server {
+                // Note: The starts_with uses case insensitive search here
+                if starts_with(name, "HTTP_") {
+                    let name = ucwords(
+                        strtolower(
+                            str_replace(
+                                "_",
+                                " ",
+                                substr(name, 5)
+                            )
                         )
-                    )
-                );
+                    );
 
-                let name = str_replace(" ", "-", name);
+                    let name = str_replace(" ", "-", name);
 
-                let headers[name] = value;
+                    let headers[name] = value;
 
-                continue;
-            }
+                    continue;
+                }
 
-            // The "CONTENT_" headers are not prefixed with "HTTP_".
-            let name = strtoupper(name);
+                // The "CONTENT_" headers are not prefixed with "HTTP_".
+                let name = strtoupper(name);
 
-            if isset contentHeaders[name] {
-                let name = ucwords(
-                    strtolower(
-                        str_replace("_", " ", name)
-                    )
-                );
+                if isset contentHeaders[name] {
+                    let name = ucwords(
+                        strtolower(
+                            str_replace("_", " ", name)
+                        )
+                    );
 
-                let name = str_replace(" ", "-", name);
+                    let name = str_replace(" ", "-", name);
 
-                let headers[name] = value;
+                    let headers[name] = value;
+                }
             }
+
+            let this->headers       = headers,
+                this->headersServer = server;
         }
 
         let authHeaders = this->resolveAuthorizationHeaders();
 
         // Protect for future (child classes) changes
-        let headers = array_merge(headers, authHeaders);
-
-        return headers;
+        return array_merge(this->headers, authHeaders);
     }
 
     /**
@@ -998,11 +1027,11 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
      */
     final public function hasHeader(string! header) -> bool
     {
-        var name;
+        var names;
 
-        let name = strtoupper(strtr(header, "-", "_"));
+        let names = this->getHeaderNames(header);
 
-        return this->hasServer(name) || this->hasServer("HTTP_" . name);
+        return this->hasServer(names[0]) || this->hasServer(names[1]);
     }
 
     /**
@@ -1456,36 +1485,50 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
     }
 
     /**
-     * Process a request header and return an array of values with their qualities
+     * Process a request header and return an array of values with their
+     * qualities. The values are parsed once for each header value
      */
     final protected function getQualityHeader(string! serverIndex, string! name) -> array
     {
-        var headerPart, headerParts, headerSplit, part, parts, returnedParts, serverValue, split;
-
-        let returnedParts = [],
-            serverValue   = this->getServer(serverIndex);
+        var cached, equalPosition, headerPart, headerParts, headerSplit, part,
+            parts, returnedParts, serverValue;
 
+        let serverValue = this->getServer(serverIndex);
         let serverValue = (null === serverValue) ? "" : serverValue;
 
-        let parts = preg_split(
-            "/,\\s*/",
-            serverValue,
-            -1,
-            PREG_SPLIT_NO_EMPTY
-        );
+        if fetch cached, this->qualityHeaders[serverIndex] {
+            if cached[0] === serverValue && cached[1] === name {
+                return cached[2];
+            }
+        }
+
+        let returnedParts = [],
+            parts         = explode(",", serverValue);
 
         for part in parts {
+            let part = trim(part);
+
+            if part === "" {
+                continue;
+            }
+
             let headerParts = [],
-                headerSplit = preg_split("/\s*;\s*/", trim(part), -1, PREG_SPLIT_NO_EMPTY);
+                headerSplit = explode(";", part);
 
             for headerPart in headerSplit {
-                if strpos(headerPart, "=") !== false {
-                    let split = explode("=", headerPart, 2);
+                let headerPart = trim(headerPart);
+
+                if headerPart === "" {
+                    continue;
+                }
 
-                    if split[0] === "q" {
-                        let headerParts["quality"] = (double) split[1];
+                let equalPosition = strpos(headerPart, "=");
+
+                if equalPosition !== false {
+                    if substr(headerPart, 0, equalPosition) === "q" {
+                        let headerParts["quality"] = (double) substr(headerPart, equalPosition + 1);
                     } else {
-                        let headerParts[split[0]] = split[1];
+                        let headerParts[substr(headerPart, 0, equalPosition)] = substr(headerPart, equalPosition + 1);
                     }
                 } else {
                     let headerParts[name] = headerPart;
@@ -1496,6 +1539,8 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
             let returnedParts[] = headerParts;
         }
 
+        let this->qualityHeaders[serverIndex] = [serverValue, name, returnedParts];
+
         return returnedParts;
     }
 
@@ -1660,6 +1705,24 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
         return this->filterService;
     }
 
+    /**
+     * Returns the server names of a header, without and with the `HTTP_`
+     * prefix
+     */
+    private function getHeaderNames(string! header) -> array
+    {
+        var name, names;
+
+        if !fetch names, this->headerNames[header] {
+            let name  = strtoupper(strtr(header, "-", "_")),
+                names = [name, "HTTP_" . name];
+
+            let this->headerNames[header] = names;
+        }
+
+        return names;
+    }
+
     private function getServerArray() -> array
     {
         if _SERVER {
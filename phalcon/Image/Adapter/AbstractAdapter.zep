@@ -35,6 +35,14 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected image = null;
 
+    /**
+     * Whether the image has been decoded. Adapters opening a file read its
+     * size only and decode it on the first operation needing the pixels
+     *
+     * @var bool
+     */
+    protected loaded = true;
+
     /**
      * Image mime type
      *
@@ -47,6 +55,16 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected realpath;
 
+    /**
+     * Pending resize and crop, applied as a single resample by the next
+     * operation needing the pixels. Holds the x, y, width and height of the
+     * area to resample, then the width and height of the image it is
+     * measured on
+     *
+     * @var array|null
+     */
+    protected region = null;
+
     /**
      * Image type
      *
@@ -93,6 +111,8 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        this->flush();
+
         this->{"processBackground"}(colors[0], colors[1], colors[2], opacity);
 
         return this;
@@ -109,6 +129,8 @@ abstract class AbstractAdapter implements AdapterInterface
     {
         let radius = this->checkHighLow(radius, 1);
 
+        this->flush();
+
         this->{"processBlur"}(radius);
 
         return this;
@@ -130,6 +152,8 @@ abstract class AbstractAdapter implements AdapterInterface
         int offsetX = null,
         int offsetY = null
     ) -> <AdapterInterface> {
+        var region, scaleX, scaleY;
+
         if (null === offsetX) {
             let offsetX = ((this->width - width) / 2);
         } else {
@@ -152,7 +176,25 @@ abstract class AbstractAdapter implements AdapterInterface
             let height = this->height - offsetY;
         }
 
-        this->{"processCrop"}(width, height, offsetX, offsetY);
+        /**
+         * The crop is mapped on the area of the image to resample, which is
+         * measured before any pending resize
+         */
+        let region = this->getRegion(),
+            scaleX = region[2] / this->width,
+            scaleY = region[3] / this->height;
+
+        let this->region = [
+            region[0] + offsetX * scaleX,
+            region[1] + offsetY * scaleY,
+            width * scaleX,
+            height * scaleY,
+            region[4],
+            region[5]
+        ];
+
+        let this->width  = width,
+            this->height = height;
 
         return this;
     }
@@ -170,6 +212,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let direction = Enum::HORIZONTAL;
         }
 
+        this->flush();
+
         this->{"processFlip"}(direction);
 
         return this;
@@ -188,6 +232,8 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     public function getImage()
     {
+        this->flush();
+
         return this->image;
     }
 
@@ -232,6 +278,8 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     public function mask(<AdapterInterface> mask) -> <AdapterInterface>
     {
+        this->flush();
+
         this->{"processMask"}(mask);
 
         return this;
@@ -250,6 +298,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let amount = 2;
         }
 
+        this->flush();
+
         this->{"processPixelate"}(amount);
 
         return this;
@@ -275,6 +325,8 @@ abstract class AbstractAdapter implements AdapterInterface
 
         let opacity = this->checkHighLow(opacity);
 
+        this->flush();
+
         this->{"processReflection"}(height, opacity, fadeIn);
 
         return this;
@@ -300,6 +352,8 @@ abstract class AbstractAdapter implements AdapterInterface
 
         let quality = this->checkHighLow(quality, 1);
 
+        this->flush();
+
         return this->{"processRender"}(extension, quality);
     }
 
@@ -318,7 +372,7 @@ abstract class AbstractAdapter implements AdapterInterface
         int height = null,
         int master = Enum::AUTO
     ) -> <AdapterInterface> {
-        var ratio;
+        var ratio, region;
 
         switch (master) {
             case Enum::TENSILE:
@@ -379,7 +433,13 @@ abstract class AbstractAdapter implements AdapterInterface
         let width  = (int) max(round(width), 1);
         let height = (int) max(round(height), 1);
 
-        this->{"processResize"}(width, height);
+        /**
+         * The resample is deferred, so it can be fused with a following crop
+         */
+        let region       = this->getRegion(),
+            this->region = region,
+            this->width  = width,
+            this->height = height;
 
         return this;
     }
@@ -405,6 +465,8 @@ abstract class AbstractAdapter implements AdapterInterface
             }
         }
 
+        this->flush();
+
         this->{"processRotate"}(degrees);
 
         return this;
@@ -424,6 +486,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let file = (string) this->realpath;
         }
 
+        this->flush();
+
         this->{"processSave"}(file, quality);
 
         return this;
@@ -440,6 +504,8 @@ abstract class AbstractAdapter implements AdapterInterface
     {
         let amount = this->checkHighLow(amount, 1);
 
+        this->flush();
+
         this->{"processSharpen"}(amount);
 
         return this;
@@ -487,6 +553,8 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        this->flush();
+
         this->{"processText"}(
             text,
             offsetX,
@@ -534,6 +602,8 @@ abstract class AbstractAdapter implements AdapterInterface
 
         let op = this->checkHighLow(opacity);
 
+        this->flush();
+
         this->{"processWatermark"}(watermark, x, y, opacity);
 
         return this;
@@ -550,4 +620,167 @@ abstract class AbstractAdapter implements AdapterInterface
     {
         return min(max, max(value, min));
     }
+
+    /**
+     * Decodes the image if needed and applies the pending resize and crop
+     * with a single resample
+     *
+     * @return void
+     */
+    protected function flush() -> void
+    {
+        var region;
+        int height, offsetX, offsetY, width;
+
+        this->load();
+
+        if (null === this->region) {
+            return;
+        }
+
+        let region       = this->region,
+            this->region = null;
+
+        let offsetX = (int) round(region[0]),
+            offsetY = (int) round(region[1]),
+            width   = (int) max(round(region[2]), 1),
+            height  = (int) max(round(region[3]), 1);
+
+        if (width > (region[4] - offsetX)) {
+            let width = region[4] - offsetX;
+        }
+
+        if (height > (region[5] - offsetY)) {
+            let height = region[5] - offsetY;
+        }
+
+        if (
+            0 === offsetX &&
+            0 === offsetY &&
+            width == region[4] &&
+            height == region[5]
+        ) {
+            if (width !== this->width || height !== this->height) {
+                this->{"processResize"}(this->width, this->height);
+            }
+
+            return;
+        }
+
+        if (width === this->width && height === this->height) {
+            this->{"processCrop"}(width, height, offsetX, offsetY);
+
+            return;
+        }
+
+        this->{"processResample"}(
+            this->width,
+            this->height,
+            offsetX,
+            offsetY,
+            width,
+            height
+        );
+    }
+
+    /**
+     * Returns the pending region, or the whole image when there is none
+     *
+     * @return array
+     */
+    protected function getRegion() -> array
+    {
+        if (null !== this->region) {
+            return this->region;
+        }
+
+        return [0, 0, this->width, this->height, this->width, this->height];
+    }
+
+    /**
+     * Decodes the image. The adapter is given the smallest size keeping the
+     * resolution of a pending resize and crop, or the full size otherwise,
+     * which it may use to decode a downscaled image, and returns the size it
+     * decoded
+     *
+     * @return void
+     */
+    protected function load() -> void
+    {
+        var decoded, region, scale, scaleX, scaleY;
+
+        if (true === this->loaded) {
+            return;
+        }
+
+        let region = this->getRegion(),
+            scale  = 1;
+
+        /**
+         * Only a resize fused with a crop is decoded at a reduced size, a
+         * single resize or crop keeps the resolution it had when the image
+         * was decoded by the constructor
+         */
+        if (
+            (region[0] > 0 || region[1] > 0 || region[2] < region[4] || region[3] < region[5]) &&
+            (this->width != region[2] || this->height != region[3])
+        ) {
+            let scale = max(this->width / region[2], this->height / region[3]);
+
+            if (scale > 1) {
+                let scale = 1;
+            }
+        }
+
+        let decoded = this->{"processLoad"}(
+            (int) ceil(region[4] * scale),
+            (int) ceil(region[5] * scale)
+        );
+
+        let this->loaded = true;
+
+        if (null === this->region) {
+            let this->width  = decoded[0],
+                this->height = decoded[1];
+
+            return;
+        }
+
+        let scaleX = decoded[0] / region[4],
+            scaleY = decoded[1] / region[5];
+
+        let this->region = [
+            region[0] * scaleX,
+            region[1] * scaleY,
+            region[2] * scaleX,
+            region[3] * scaleY,
+            decoded[0],
+            decoded[1]
+        ];
+    }
+
+    /**
+     * Resamples an area of the image to the given size. Adapters without a
+     * single pass resample crop the area and resize it
+     *
+     * @param int $width
+     * @param int $height
+     * @param int $offsetX
+     * @param int $offsetY
+     * @param int $cropWidth
+     * @param int $cropHeight
+     *
+     * @return void
+     */
+    protected function processResample(
+        int width,
+        int height,
+        int offsetX,
+        int offsetY,
+        int cropWidth,
+        int cropHeight
+    ) -> void {
+        this->{"processCrop"}(cropWidth, cropHeight, offsetX, offsetY);
+        this->{"processResize"}(width, height);
+    }
 }
@@ -47,28 +47,12 @@ class Gd extends AbstractAdapter
 
             switch (this->type) {
                 case IMAGETYPE_GIF:
-                    let this->image = imagecreatefromgif(this->file);
-                    break;
-
                 case IMAGETYPE_JPEG:
                 case IMAGETYPE_JPEG2000:
-                    let this->image = imagecreatefromjpeg(this->file);
-                    break;
-
                 case IMAGETYPE_PNG:
-                    let this->image = imagecreatefrompng(this->file);
-                    break;
-
                 case IMAGETYPE_WEBP:
-                    let this->image = imagecreatefromwebp(this->file);
-                    break;
-
                 case IMAGETYPE_WBMP:
-                    let this->image = imagecreatefromwbmp(this->file);
-                    break;
-
                 case IMAGETYPE_XBM:
-                    let this->image = imagecreatefromxbm(this->file);
                     break;
 
                 default:
@@ -83,7 +67,10 @@ class Gd extends AbstractAdapter
                     );
             }
 
-            imagesavealpha(this->image, true);
+            /**
+             * The image is decoded by the first operation needing it
+             */
+            let this->loaded = false;
         } else {
             if (null === width || null === height) {
                 throw new Exception(
@@ -210,7 +197,16 @@ class Gd extends AbstractAdapter
      */
     protected function processBlur(int radius) -> void
     {
-        var counter;
+        var counter, processed;
+
+        /**
+         * Truecolor images are blurred natively
+         */
+        let processed = phalcon_image_gd_blur(this->image, radius);
+
+        if processed {
+            return;
+        }
 
         let counter = 0;
         while (counter < radius) {
@@ -285,6 +281,64 @@ class Gd extends AbstractAdapter
         }
     }
 
+    /**
+     * GD cannot decode a downscaled image, the size is not used
+     *
+     * @param int $width
+     * @param int $height
+     *
+     * @return array
+     */
+    protected function processLoad(int width, int height) -> array
+    {
+        var image;
+
+        let image = false;
+
+        switch (this->type) {
+            case IMAGETYPE_GIF:
+                let image = imagecreatefromgif(this->file);
+                break;
+
+            case IMAGETYPE_JPEG:
+            case IMAGETYPE_JPEG2000:
+                let image = imagecreatefromjpeg(this->file);
+                break;
+
+            case IMAGETYPE_PNG:
+                let image = imagecreatefrompng(this->file);
+                break;
+
+            case IMAGETYPE_WEBP:
+                let image = imagecreatefromwebp(this->file);
+                break;
+
+            case IMAGETYPE_WBMP:
+                let image = imagecreatefromwbmp(this->file);
+                break;
+
+            case IMAGETYPE_XBM:
+                let image = imagecreatefromxbm(this->file);
+                break;
+        }
+
+        /**
+         * The header read by the constructor does not guarantee that the
+         * pixels can be decoded
+         */
+        if (unlikely false === image) {
+            throw new Exception(
+                "Failed to create image from file " . this->file
+            );
+        }
+
+        imagesavealpha(image, true);
+
+        let this->image = image;
+
+        return [imagesx(this->image), imagesy(this->image)];
+    }
+
     /**
      * @param AdapterInterface $mask
      *
@@ -382,7 +436,16 @@ class Gd extends AbstractAdapter
      */
     protected function processPixelate(int amount) -> void
     {
-        var color, x, x1, x2, y, y1, y2;
+        var color, processed, x, x1, x2, y, y1, y2;
+
+        /**
+         * Truecolor images are pixelated natively, averaging every block
+         */
+        let processed = phalcon_image_gd_pixelate(this->image, amount);
+
+        if processed {
+            return;
+        }
 
         let x = 0;
 
@@ -429,7 +492,7 @@ class Gd extends AbstractAdapter
         int opacity,
         bool fadeIn
     ) -> void {
-        var line, reflection;
+        var line, processed, reflection;
         int destinationY, destinationOpacity, offset, stepping, sourceY;
 
         let opacity = (int) round(abs((opacity * 127 / 100) - 127));
@@ -456,55 +519,69 @@ class Gd extends AbstractAdapter
             this->height
         );
 
-        let offset = 0;
-        while (height >= offset) {
-            let sourceY      = this->height - offset - 1;
-            let destinationY = this->height + offset;
+        /**
+         * Truecolor images are reflected natively in a single pass
+         */
+        let processed = phalcon_image_gd_reflection(
+            reflection,
+            this->image,
+            height,
+            opacity,
+            stepping,
+            fadeIn
+        );
 
-            if (fadeIn) {
-                let destinationOpacity = (int) round(
-                    opacity + (stepping * (height - offset))
-                );
-            } else {
-                let destinationOpacity = (int) round(
-                    opacity + (stepping * offset)
-                );
-            }
+        if !processed {
+            let offset = 0;
+            while (height >= offset) {
+                let sourceY      = this->height - offset - 1;
+                let destinationY = this->height + offset;
 
-            let line = this->processCreate(this->width, 1);
+                if (fadeIn) {
+                    let destinationOpacity = (int) round(
+                        opacity + (stepping * (height - offset))
+                    );
+                } else {
+                    let destinationOpacity = (int) round(
+                        opacity + (stepping * offset)
+                    );
+                }
 
-            imagecopy(
-                line,
-                this->image,
-                0,
-                0,
-                0,
-                sourceY,
-                this->width,
-                1
-            );
+                let line = this->processCreate(this->width, 1);
 
-            imagefilter(
-                line,
-                IMG_FILTER_COLORIZE,
-                0,
-                0,
-                0,
-                destinationOpacity
-            );
+                imagecopy(
+                    line,
+                    this->image,
+                    0,
+                    0,
+                    0,
+                    sourceY,
+                    this->width,
+                    1
+                );
 
-            imagecopy(
-                reflection,
-                line,
-                0,
-                destinationY,
-                0,
-                0,
-                this->width,
-                1
-            );
+                imagefilter(
+                    line,
+                    IMG_FILTER_COLORIZE,
+                    0,
+                    0,
+                    0,
+                    destinationOpacity
+                );
+
+                imagecopy(
+                    reflection,
+                    line,
+                    0,
+                    destinationY,
+                    0,
+                    0,
+                    this->width,
+                    1
+                );
 
-            let offset++;
+                let offset++;
+            }
         }
 
         imagedestroy(this->image);
@@ -555,6 +632,50 @@ class Gd extends AbstractAdapter
         return ob_get_clean();
     }
 
+    /**
+     * Resamples an area of the image to the given size in one pass
+     *
+     * @param int $width
+     * @param int $height
+     * @param int $offsetX
+     * @param int $offsetY
+     * @param int $cropWidth
+     * @param int $cropHeight
+     *
+     * @return void
+     */
+    protected function processResample(
+        int width,
+        int height,
+        int offsetX,
+        int offsetY,
+        int cropWidth,
+        int cropHeight
+    ) -> void {
+        var image;
+
+        let image = this->processCreate(width, height);
+
+        imagecopyresampled(
+            image,
+            this->image,
+            0,
+            0,
+            offsetX,
+            offsetY,
+            width,
+            height,
+            cropWidth,
+            cropHeight
+        );
+
+        imagedestroy(this->image);
+
+        let this->image  = image;
+        let this->width  = imagesx(image);
+        let this->height = imagesy(image);
+    }
+
     /**
      * @param int $width
      * @param int $height
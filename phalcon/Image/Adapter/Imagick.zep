@@ -56,8 +56,6 @@ class Imagick extends AbstractAdapter
         int width = null,
         int height = null
     ) {
-        var image;
-
         this->check();
 
         let this->file  = file;
@@ -66,30 +64,17 @@ class Imagick extends AbstractAdapter
         if (true === file_exists(this->file)) {
             let this->realpath = realpath(this->file);
 
-            if (true !== this->image->readImage(this->realpath)) {
+            /**
+             * Only the properties of the image are read, it is decoded by
+             * the first operation needing it
+             */
+            if (true !== this->image->pingImage(this->realpath)) {
                 throw new Exception(
-                    "Imagick::readImage " . this->file . " failed"
-                );
-            }
-
-            if (!this->image->getImageAlphaChannel()) {
-                this->image->setImageAlphaChannel(
-                    constant("Imagick::ALPHACHANNEL_SET")
+                    "Imagick::pingImage " . this->file . " failed"
                 );
             }
-            let this->type = this->image->getImageType();
-
-            /**
-             * GIF
-             */
-            if (this->image->getImageType() == IMAGETYPE_GIF) {
-                let image = this->image->coalesceImages();
-
-                this->image->clear();
-                this->image->destroy();
 
-                let this->image = image;
-            }
+            let this->loaded = false;
         } else {
             if (null === width || null === height) {
                 throw new Exception(
@@ -126,6 +111,17 @@ class Imagick extends AbstractAdapter
         }
     }
 
+    /**
+     * @return int
+     * @throws ImagickException
+     */
+    public function getType() -> int
+    {
+        this->load();
+
+        return this->type;
+    }
+
     /**
      * This method scales the images using liquid rescaling method. Only support
      * Imagick
@@ -149,6 +145,8 @@ class Imagick extends AbstractAdapter
     ) -> <AbstractAdapter> {
         var image, result;
 
+        this->flush();
+
         let image = this->image;
 
         image->setIteratorIndex(0);
@@ -356,6 +354,68 @@ class Imagick extends AbstractAdapter
         }
     }
 
+    /**
+     * Decodes the image. JPEG images are decoded downscaled to the given size
+     * when it is smaller
+     *
+     * @param int $width
+     * @param int $height
+     *
+     * @return array
+     * @throws Exception
+     * @throws ImagickException
+     */
+    protected function processLoad(int width, int height) -> array
+    {
+        var image, sourceHeight, sourceWidth;
+
+        /**
+         * The size read by pingImage()
+         */
+        let sourceWidth  = this->image->getImageWidth(),
+            sourceHeight = this->image->getImageHeight();
+
+        this->image->clear();
+
+        if (
+            "image/jpeg" === strtolower(this->mime) &&
+            (width < sourceWidth || height < sourceHeight)
+        ) {
+            this->image->setOption("jpeg:size", width . "x" . height);
+        }
+
+        if (true !== this->image->readImage(this->realpath)) {
+            throw new Exception(
+                "Imagick::readImage " . this->file . " failed"
+            );
+        }
+
+        if (!this->image->getImageAlphaChannel()) {
+            this->image->setImageAlphaChannel(
+                constant("Imagick::ALPHACHANNEL_SET")
+            );
+        }
+
+        /**
+         * GIF
+         */
+        if (this->image->getImageType() == IMAGETYPE_GIF) {
+            let image = this->image->coalesceImages();
+
+            this->image->clear();
+            this->image->destroy();
+
+            let this->image = image;
+        }
+
+        let this->type = this->image->getImageType();
+
+        return [
+            this->image->getImageWidth(),
+            this->image->getImageHeight()
+        ];
+    }
+
     /**
      * Composite one image onto another
      *
@@ -608,6 +668,53 @@ class Imagick extends AbstractAdapter
         return image->getImageBlob();
     }
 
+    /**
+     * Resamples an area of the image to the given size. Downscaled frames
+     * are made with thumbnailImage(), which also drops their profiles
+     *
+     * @param int $width
+     * @param int $height
+     * @param int $offsetX
+     * @param int $offsetY
+     * @param int $cropWidth
+     * @param int $cropHeight
+     *
+     * @return void
+     * @throws ImagickException
+     */
+    protected function processResample(
+        int width,
+        int height,
+        int offsetX,
+        int offsetY,
+        int cropWidth,
+        int cropHeight
+    ) -> void {
+        var image;
+
+        let image = this->image;
+
+        image->setIteratorIndex(0);
+
+        while (true) {
+            image->cropImage(cropWidth, cropHeight, offsetX, offsetY);
+            image->setImagePage(cropWidth, cropHeight, 0, 0);
+
+            if (width < cropWidth && height < cropHeight) {
+                image->thumbnailImage(width, height);
+            } else {
+                image->scaleImage(width, height);
+            }
+
+            if (true !== image->nextImage()) {
+                break;
+            }
+        }
+
+        let this->width  = image->getImageWidth();
+        let this->height = image->getImageHeight();
+    }
+
     /**
      * Execute a resize.
      *
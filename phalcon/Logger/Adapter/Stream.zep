@@ -29,12 +29,69 @@ use Phalcon\Logger\Item;
  * $logger->close();
  *```
  *
+ * Lines can be buffered in memory and written with a single append once
+ * `bufferSize` bytes or `bufferLines` lines are collected. The file is then
+ * kept open until the adapter is closed or destroyed, which also writes the
+ * remaining lines
+ *
+ *```php
+ * $logger = new \Phalcon\Logger\Adapter\Stream(
+ *     'app/logs/test.log',
+ *     [
+ *         'bufferSize'  => 65536,
+ *         'bufferLines' => 100,
+ *     ]
+ * );
+ *```
+ *
  * @property string        $mode
  * @property string        $name
  * @property array         $options
  */
 class Stream extends AbstractAdapter
 {
+    /**
+     * Lines waiting to be written
+     *
+     * @var string
+     */
+    protected buffer = "";
+
+    /**
+     * Number of lines waiting to be written
+     *
+     * @var int
+     */
+    protected bufferCount = 0;
+
+    /**
+     * Number of lines that triggers a write. 0 disables the threshold
+     *
+     * @var int
+     */
+    protected bufferLines = 0;
+
+    /**
+     * Number of bytes that triggers a write. 0 disables the threshold
+     *
+     * @var int
+     */
+    protected bufferSize = 0;
+
+    /**
+     * File handler kept open while buffering
+     *
+     * @var resource|null
+     */
+    protected handler = null;
+
+    /**
+     * Tells if the queue of a transaction is being committed
+     *
+     * @var bool
+     */
+    protected inCommit = false;
+
     /**
      * The file open mode. Defaults to 'ab'
      *
@@ -76,18 +133,94 @@ class Stream extends AbstractAdapter
             throw new Exception("Adapter cannot be opened in read mode");
         }
 
-        let this->name = name,
-            this->mode = mode;
+        let this->name        = name,
+            this->mode        = mode,
+            this->bufferLines = (int) this->getArrVal(options, "bufferLines", 0),
+            this->bufferSize  = (int) this->getArrVal(options, "bufferSize", 0);
     }
 
     /**
-     * Closes the stream
+     * Closes the stream, writing the buffered lines first
      */
     public function close() -> bool
     {
+        var handler;
+
+        this->flush();
+
+        let handler = this->handler;
+
+        if is_resource(handler) {
+            fclose(handler);
+        }
+
+        let this->handler = null;
+
         return true;
     }
 
+    /**
+     * Writes the transaction queue to the file with a single append
+     *
+     * @return AdapterInterface
+     * @throws Exception
+     */
+    public function commit() -> <AdapterInterface>
+    {
+        var ex;
+
+        let this->inCommit = true;
+
+        try {
+            parent::commit();
+        } catch \Throwable, ex {
+            let this->inCommit = false;
+
+            throw ex;
+        }
+
+        let this->inCommit = false;
+
+        if this->isBuffered() {
+            this->flushIfFull();
+        } else {
+            this->flush();
+        }
+
+        return this;
+    }
+
+    /**
+     * Writes the buffered lines to the file
+     *
+     * @return AdapterInterface
+     */
+    public function flush() -> <AdapterInterface>
+    {
+        var buffer;
+
+        let buffer = this->buffer;
+
+        if "" !== buffer {
+            let this->buffer      = "",
+                this->bufferCount = 0;
+
+            this->write(buffer);
+        }
+
+        return this;
+    }
+
+    /**
+     * Returns the buffered lines that are not written yet
+     *
+     * @return string
+     */
+    public function getBuffer() -> string
+    {
+        return this->buffer;
+    }
+
     /**
      * Stream name
      *
@@ -105,28 +238,60 @@ class Stream extends AbstractAdapter
      */
     public function process(<Item> item) -> void
     {
-        var handler, message;
+        var message;
+
+        let message = this->getFormattedItem(item) . PHP_EOL;
 
-        let handler = this->phpFopen(this->name, this->mode);
+        if this->inCommit || this->isBuffered() {
+            let this->buffer .= message,
+                this->bufferCount++;
 
-        if !is_resource(handler) {
-            throw new LogicException(
-                "The file '" .
-                this->name .
-                "' cannot be opened with mode '" .
-                this->mode .
-                "'"
-            );
+            if !this->inCommit {
+                this->flushIfFull();
+            }
+
+            return;
         }
 
-        /**
-         * Not much we can do about locking
-         */
-        flock(handler, LOCK_EX);
-        let message = this->getFormattedItem(item) . PHP_EOL;
-        fwrite(handler, message);
+        this->write(message);
+    }
+
+    /**
+     * Writes the buffer when one of its thresholds is reached
+     */
+    protected function flushIfFull() -> void
+    {
+        if (
+            (this->bufferSize > 0 && strlen(this->buffer) >= this->bufferSize) ||
+            (this->bufferLines > 0 && this->bufferCount >= this->bufferLines)
+        ) {
+            this->flush();
+        }
+    }
+
+    /**
+     * @todo to be removed when we get traits
+     */
+    protected function getArrVal(
+        array! collection,
+        var index,
+        var defaultValue = null
+    ) -> var {
+        var value;
 
-        fclose(handler);
+        if unlikely !fetch value, collection[index] {
+            return defaultValue;
+        }
+
+        return value;
+    }
+
+    /**
+     * Whether the lines are collected in memory before being written
+     */
+    protected function isBuffered() -> bool
+    {
+        return this->bufferSize > 0 || this->bufferLines > 0;
     }
 
     /**
@@ -136,4 +301,56 @@ class Stream extends AbstractAdapter
     {
         return fopen(filename, mode);
     }
+
+    /**
+     * Appends the message to the file. Without buffering the file is opened
+     * and locked for every message. With buffering the handler stays open and
+     * is only locked for writes larger than PIPE_BUF, smaller appends are
+     * atomic
+     *
+     * @param string $message
+     */
+    private function write(string message) -> void
+    {
+        var handler;
+        bool locked, persistent;
+
+        let persistent = this->isBuffered(),
+            handler    = this->handler;
+
+        if !is_resource(handler) {
+            let handler = this->phpFopen(this->name, this->mode);
+
+            if !is_resource(handler) {
+                throw new LogicException(
+                    "The file '" .
+                    this->name .
+                    "' cannot be opened with mode '" .
+                    this->mode .
+                    "'"
+                );
+            }
+
+            if persistent {
+                let this->handler = handler;
+            }
+        }
+
+        let locked = !persistent || strlen(message) > 4096;
+
+        /**
+         * Not much we can do about locking
+         */
+        if locked {
+            flock(handler, LOCK_EX);
+        }
+
+        fwrite(handler, message);
+
+        if !persistent {
+            fclose(handler);
+        } elseif locked {
+            flock(handler, LOCK_UN);
+        }
+    }
 }
@@ -34,6 +34,7 @@ use Phalcon\Mvc\Model\Query\BuilderInterface;
 use Phalcon\Mvc\Model\QueryInterface;
 use Phalcon\Mvc\Model\ResultInterface;
 use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Mvc\Model\Resultset\Simple;
 use Phalcon\Mvc\Model\ResultsetInterface;
 use Phalcon\Mvc\Model\Relation;
 use Phalcon\Mvc\Model\RelationInterface;
@@ -44,6 +45,7 @@ use Phalcon\Filter\Validation\ValidationInterface;
 use Phalcon\Support\Collection;
 use Phalcon\Support\Collection\CollectionInterface;
 use Serializable;
+use Throwable;
 
 /**
  * Phalcon\Mvc\Model
@@ -104,6 +106,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     protected dirtyRelated = [];
 
+    /**
+     * @var array
+     */
+    protected eagerLoaded = [];
+
     /**
      * @var array
      */
@@ -437,6 +444,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 }
 
                 unset this->related[lowerProperty];
+                unset this->eagerLoaded[lowerProperty];
 
                 let this->dirtyRelated[lowerProperty] = value,
                     this->dirtyState                  = dirtyState;
@@ -472,6 +480,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                             referencedModel->assign(value);
 
                             unset this->related[lowerProperty];
+                            unset this->eagerLoaded[lowerProperty];
 
                             let this->dirtyRelated[lowerProperty] = referencedModel,
                                 this->dirtyState = self::DIRTY_STATE_TRANSIENT;
@@ -494,6 +503,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                         }
 
                         unset this->related[lowerProperty];
+                        unset this->eagerLoaded[lowerProperty];
 
                         if count(related) > 0 {
                             let this->dirtyRelated[lowerProperty] = related,
@@ -902,11 +912,13 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     }
 
     /**
-     * Assigns values to a model from an array, returning a new model.
+     * Assigns values from an array to an existing model, the same way
+     * cloneResultMap() does on a clone of its base. Streamed resultsets use it
+     * to hydrate every row into a single record
      *
      *```php
-     * $robot = \Phalcon\Mvc\Model::cloneResultMap(
-     *     new Robots(),
+     * $robot = \Phalcon\Mvc\Model::assignResultMap(
+     *     $robot,
      *     [
      *         "type" => "mechanical",
      *         "name" => "Astro Boy",
@@ -915,18 +927,25 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      * );
      *```
      *
-     * @param ModelInterface|\Phalcon\Mvc\Model\Row base
+     * @param ModelInterface|\Phalcon\Mvc\Model\Row instance
      * @param mixed columnMap
      * @param int dirtyState
      * @param bool keepSnapshots
      *
      * @return ModelInterface
      */
-    public static function cloneResultMap(var base, array! data, var columnMap, int dirtyState = 0, bool keepSnapshots = null) -> <ModelInterface>
+    public static function assignResultMap(var instance, array! data, var columnMap, int dirtyState = 0, bool keepSnapshots = null) -> <ModelInterface>
     {
-        var instance, attribute, key, value, castValue, attributeName, metaData, reverseMap;
+        var attribute, key, value, castValue, attributeName, metaData, reverseMap;
 
-        let instance = clone base;
+        /**
+         * A reused record must not keep the related records of another row
+         */
+        if instance instanceof Model {
+            let instance->related      = [],
+                instance->dirtyRelated = [],
+                instance->eagerLoaded  = [];
+        }
 
         // Change the dirty state to persistent
         instance->setDirtyState(dirtyState);
@@ -955,7 +974,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                     if !fetch attribute, reverseMap[key] {
                         if unlikely !globals_get("orm.ignore_unknown_columns") {
                             throw new Exception(
-                                "Column '" . key . "' doesn't make part of the column map in '" . get_class(base) . "'"
+                                "Column '" . key . "' doesn't make part of the column map in '" . get_class(instance) . "'"
                             );
                         }
 
@@ -964,7 +983,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 } else {
                     if unlikely !globals_get("orm.ignore_unknown_columns") {
                         throw new Exception(
-                            "Column '" . key . "' doesn't make part of the column map in '" . get_class(base) . "'"
+                            "Column '" . key . "' doesn't make part of the column map in '" . get_class(instance) . "'"
                         );
                     }
 
@@ -1045,6 +1064,38 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return instance;
     }
 
+    /**
+     * Assigns values to a model from an array, returning a new model.
+     *
+     *```php
+     * $robot = \Phalcon\Mvc\Model::cloneResultMap(
+     *     new Robots(),
+     *     [
+     *         "type" => "mechanical",
+     *         "name" => "Astro Boy",
+     *         "year" => 1952,
+     *     ]
+     * );
+     *```
+     *
+     * @param ModelInterface|\Phalcon\Mvc\Model\Row base
+     * @param mixed columnMap
+     * @param int dirtyState
+     * @param bool keepSnapshots
+     *
+     * @return ModelInterface
+     */
+    public static function cloneResultMap(var base, array! data, var columnMap, int dirtyState = 0, bool keepSnapshots = null) -> <ModelInterface>
+    {
+        return self::assignResultMap(
+            clone base,
+            data,
+            columnMap,
+            dirtyState,
+            keepSnapshots
+        );
+    }
+
     /**
      * Returns an hydrated result based on the data and the column map
      *
@@ -1428,7 +1479,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * we can get proper counts.
          */
         if (success) {
-            let this->related = [];
+            let this->related     = [],
+                this->eagerLoaded = [];
             this->modelsManager->clearReusableObjects();
         }
 
@@ -1612,6 +1664,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *
      * $transaction1->rollback();
      * $transaction2->rollback();
+     *
+     * // Eager load relations, issuing one query per relation level
+     * $invoices = Invoices::find(
+     *     [
+     *         'inv_status_flag = 1',
+     *         'with' => ['customer', 'lines.product'],
+     *     ]
+     * );
      * ```
      *
      * @param array|string|int|null parameters = [
@@ -1629,13 +1689,16 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *         'lifetime' => 3600,
      *         'key' => 'my-find-key'
      *     ],
-     *     'hydration' => null
+     *     'hydration' => null,
+     *     'stream' => false,
+     *     'with' => ['customer', 'lines.product']
      * ]
      * @return T[]|\Phalcon\Mvc\Model\Resultset<int, T>
      */
     public static function find(var parameters = null)
     {
-        var params, query, resultset, hydration;
+        var params, query, resultset, hydration, with, record;
+        array records;
 
         if typeof parameters !== "array" {
             let params = [];
@@ -1647,6 +1710,12 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             let params = parameters;
         }
 
+        let with = null;
+
+        if fetch with, params["with"] {
+            unset params["with"];
+        }
+
         let query = static::getPreparedQuery(params);
 
         /**
@@ -1661,6 +1730,34 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             if fetch hydration, params["hydration"] {
                 resultset->setHydrateMode(hydration);
             }
+
+            /**
+             * Eager load the requested relations, keeping the records in the
+             * resultset so the related records are not lost on iteration
+             */
+            if with !== null {
+                if unlikely !(resultset instanceof Simple) || resultset->getHydrateMode() != Resultset::HYDRATE_RECORDS {
+                    throw new Exception(
+                        "Relations can only be eager loaded into resultsets hydrated as records"
+                    );
+                }
+
+                if unlikely resultset->isStream() {
+                    throw new Exception(
+                        "Relations cannot be eager loaded into streamed resultsets"
+                    );
+                }
+
+                let records = [];
+
+                for record in iterator(resultset) {
+                    let records[] = record;
+                }
+
+                static::eagerLoad(records, with);
+
+                resultset->setRecords(records);
+            }
         }
 
         return resultset;
@@ -1747,14 +1844,16 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *         'lifetime' => 3600,
      *         'key' => 'my-find-key'
      *     ],
-     *     'hydration' => null
+     *     'hydration' => null,
+     *     'stream' => false,
+     *     'with' => ['customer', 'lines.product']
      * ]
      *
      * @return T|\Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\Model\Row|null
      */
     public static function findFirst(var parameters = null) -> var | null
     {
-        var params, query;
+        var params, query, with, record;
 
         if null === parameters {
             let params = [];
@@ -1768,6 +1867,12 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             );
         }
 
+        let with = null;
+
+        if fetch with, params["with"] {
+            unset params["with"];
+        }
+
         let query = static::getPreparedQuery(params, 1);
 
         /**
@@ -1778,7 +1883,19 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * Execute the query passing the bind-params and casting-types
          */
-        return query->execute();
+        let record = query->execute();
+
+        if with !== null && typeof record === "object" {
+            if unlikely !(record instanceof ModelInterface) {
+                throw new Exception(
+                    "Relations can only be eager loaded into records"
+                );
+            }
+
+            static::eagerLoad([record], with);
+        }
+
+        return record;
     }
 
     /**
@@ -2090,6 +2207,19 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * If there are any arguments, Manager with handle the caching of the records
          */
         if arguments === null {
+            /**
+             * Relations loaded through the "with" parameter of find() and
+             * findFirst() are served from the related cache, as long as the
+             * key they were loaded with has not changed since
+             */
+            if array_key_exists(lowerAlias, this->eagerLoaded) && array_key_exists(lowerAlias, this->related) {
+                if this->readAttribute(relation->getFields()) === this->eagerLoaded[lowerAlias] {
+                    return this->related[lowerAlias];
+                }
+
+                unset this->eagerLoaded[lowerAlias];
+            }
+
 //            /**
 //             * If the related records are already in cache and the relation is reusable,
 //             * we return the cached records.
@@ -2482,7 +2612,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     public function refresh() -> <ModelInterface>
     {
         var metaData, readConnection, schema, source, table, uniqueKey, tables,
-            uniqueParams, dialect, row, attribute, manager, columnMap;
+            uniqueParams, dialect, row, attribute, manager, columnMap,
+            alias;
         array fields;
 
         if unlikely this->dirtyState != self::DIRTY_STATE_PERSISTENT {
@@ -2562,6 +2693,16 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         if typeof row === "array" {
             let columnMap = metaData->getColumnMap(this);
 
+            /**
+             * The eager loaded relations may no longer match the refreshed
+             * record
+             */
+            for alias, _ in this->eagerLoaded {
+                unset this->related[alias];
+            }
+
+            let this->eagerLoaded = [];
+
             this->assign(row, null, columnMap);
 
             if manager->isKeepingSnapshots(this) {
@@ -2783,174 +2924,577 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
 
 
     /**
-     * Serializes the object ignoring connections, services, related objects or
-     * static properties
+     * Saves several records at once. Every record is validated and its
+     * before* events are fired first, nothing is written if any of them
+     * fails. New records sharing connection, table and column set are then
+     * inserted with multi-row INSERT statements and the records that already
+     * exist are updated, all inside a transaction on every write connection.
+     * The after* events are fired once the transactions are committed.
+     *
+     * New records whose identity is generated by the database system are
+     * inserted one by one in the same transaction: generated identities can
+     * only be read back one insert at a time. Records with unsaved related
+     * records are saved with save() in the same transaction, once the other
+     * records are written, so they are validated then and their after*
+     * events are fired before the transactions are committed.
+     *
+     *```php
+     * $robots = [];
+     *
+     * foreach ($rows as $row) {
+     *     $robot = new Robots();
+     *
+     *     $robot->id   = $row["id"];
+     *     $robot->name = $row["name"];
+     *     $robot->year = $row["year"];
+     *
+     *     $robots[] = $robot;
+     * }
+     *
+     * Robots::saveMany($robots);
+     *```
+     *
+     * @param array|\Traversable models
      */
-    public function serialize() -> string | null
+    public static function saveMany(var models) -> bool
     {
-        /**
-         * Use the standard serialize function to serialize the array data
-         */
-        var attributes, manager, dirtyState, snapshot = null;
-
-        let attributes = this->toArray(null, false),
-            dirtyState = this->dirtyState,
-            manager = <ManagerInterface> this->getModelsManager();
-
-        if manager->isKeepingSnapshots(this) && this->snapshot != null && attributes != this->snapshot {
-            let snapshot = this->snapshot;
-        }
+        return self::doSaveMany(models);
+    }
 
-        return serialize(
+    /**
+     * Inserts several records or updates the existing rows they clash with,
+     * using multi-row INSERT statements with the upsert clause of the
+     * dialect. The records are validated and their create events fired as
+     * with saveMany(). Records clash on their primary key unless conflict
+     * fields are passed, every inserted column but the conflict fields is
+     * updated unless update fields are passed. Fields are attribute names,
+     * mapped through the column map of the model. Identity values generated
+     * by the database system are not read back.
+     *
+     *```php
+     * Robots::upsertMany($robots, ["code"], ["name", "year"]);
+     *```
+     *
+     * @param array|\Traversable models
+     * @param array|null         conflictFields
+     * @param array|null         updateFields
+     */
+    public static function upsertMany(var models, array conflictFields = null, array updateFields = null) -> bool
+    {
+        return self::doSaveMany(
+            models,
             [
-                "attributes":  attributes,
-                "snapshot":    snapshot,
-                "dirtyState":  dirtyState
+                "conflictFields" : conflictFields,
+                "updateFields"   : updateFields
             ]
         );
     }
 
     /**
-     * Unserializes the object from a serialized string
+     * Saves or upserts several records, see saveMany() and upsertMany()
+     *
+     * @param array|\Traversable models
+     * @param array|null         upsert Conflict and update fields to upsert
+     *                                  the records with
      */
-    public function unserialize(string data) -> void
+    protected static function doSaveMany(var models, var upsert = null) -> bool
     {
-        var attributes, container, manager, key, value, snapshot, properties, dirtyState;
-
-        let attributes = unserialize(data);
+        var attributeField, batch, batchKey, batches, batchModels, batchRows,
+            conflictFields, connection, connectionId, connections, defaultValue,
+            entry, exception, exists, identityField, insertData, metaData,
+            model, pending, saved, schema, snapshot, source, success, table,
+            updateFields, value;
+        bool failed;
+
+        if unlikely typeof models != "array" && !(models instanceof \Traversable) {
+            throw new Exception(
+                "The records to save must be an array or a Traversable object"
+            );
+        }
 
-        if typeof attributes === "array" {
-            if !isset attributes["attributes"] {
-                let attributes = [
-                    "attributes": attributes
-                ];
-            }
+        let pending     = [],
+            batches     = [],
+            batchRows   = [],
+            batchModels = [],
+            connections = [];
 
-            /**
-             * Obtain the default DI
-             */
-            let container = Di::getDefault();
-            if container === null {
+        /**
+         * Validate every record before writing anything
+         */
+        for model in models {
+            if unlikely typeof model != "object" || !(model instanceof Model) {
                 throw new Exception(
-                    "A dependency injection container is required to access the services related to the ODM in '" . get_class(this) . "'"
+                    "Only instances of Phalcon\\Mvc\\Model can be saved in bulk"
                 );
             }
 
-            /**
-             * Update the dependency injector
-             */
-            let this->container = container;
+            let connection   = model->getWriteConnection(),
+                connectionId = spl_object_id(connection);
+
+            let connections[connectionId] = connection;
 
             /**
-             * Gets the default modelsManager service
+             * Records with related records to save take the regular path
              */
-            let manager = <ManagerInterface> container->getShared("modelsManager");
+            if count(model->collectRelatedToSave()) > 0 {
+                if unlikely typeof upsert == "array" {
+                    throw new Exception(
+                        "Records with related records to save cannot be upserted"
+                    );
+                }
 
-            if unlikely typeof manager !== "object" {
-                throw new Exception(
-                    "The injected service 'modelsManager' is not valid in '" . get_class(this) . "'"
-                );
+                /**
+                 * save() runs the whole save sequence of the record inside
+                 * the transactions, a failure rolls every record back
+                 */
+                let pending[] = ["save", model];
+
+                continue;
             }
 
-            /**
-             * Update the models manager
-             */
-            let this->modelsManager = manager;
+            model->fireEvent("prepareSave");
 
-            /**
-             * Try to initialize the model
-             */
-            manager->initialize(this);
+            let metaData = model->getModelsMetaData(),
+                schema   = model->getSchema(),
+                source   = model->getSource();
 
-            /**
-             * Fetch serialized props
-             */
-            if fetch properties, attributes["attributes"] {
-                /**
-                 * Update the objects properties
-                 */
-                for key, value in properties {
-                    let this->{key} = value;
-                }
+            if schema {
+                let table = [schema, source];
             } else {
-                let properties = [];
+                let table = source;
             }
 
             /**
-             * Fetch serialized dirtyState
+             * Upserts leave the existence check to the database system
              */
-            if fetch dirtyState, attributes["dirtyState"] {
-                let this->dirtyState = dirtyState;
+            if typeof upsert == "array" {
+                let exists = false;
+            } else {
+                let exists = model->has(metaData, model->getReadConnection());
             }
 
-            /**
-             * Fetch serialized snapshot when option is active
-             */
-            if manager->isKeepingSnapshots(this) {
-                if fetch snapshot, attributes["snapshot"] {
-                    let this->snapshot = snapshot;
-                } else {
-                    let this->snapshot = properties;
-                }
+            if exists {
+                let model->operationMade = self::OP_UPDATE;
+            } else {
+                let model->operationMade = self::OP_CREATE;
             }
-        }
-    }
 
-    /**
-     * Sets the DependencyInjection connection service name
-     */
-    final public function setConnectionService(string! connectionService) -> void
-    {
-        (<ManagerInterface> this->modelsManager)->setConnectionService(
-            this,
-            connectionService
-        );
-    }
+            let model->errorMessages = [],
+                identityField        = metaData->getIdentityField(model);
 
-    /**
-     * Sets the dirty state of the object using one of the DIRTY_STATE_* constants
-     */
-    public function setDirtyState(int dirtyState) -> <ModelInterface> | bool
-    {
-        let this->dirtyState = dirtyState;
+            if model->preSave(metaData, exists, identityField) === false {
+                if unlikely globals_get("orm.exception_on_failed_save") {
+                    throw new ValidationFailed(
+                        model,
+                        model->getMessages()
+                    );
+                }
 
-        return this;
-    }
+                return false;
+            }
 
-    /**
-     * Sets a custom events manager
-     */
-    public function setEventsManager(<EventsManagerInterface> eventsManager)
-    {
-        this->modelsManager->setCustomEventsManager(this, eventsManager);
-    }
+            if exists {
+                let pending[] = ["update", model, metaData, table];
 
-    /**
-     * Sets the DependencyInjection connection service name used to read data
-     */
-    final public function setReadConnectionService(string! connectionService) -> void
-    {
-        (<ManagerInterface> this->modelsManager)->setReadConnectionService(
-            this,
-            connectionService
-        );
-    }
+                continue;
+            }
 
-    /**
-     * Sets the record's old snapshot data.
-     * This method is used internally to set old snapshot data when the model
-     * was set up to keep snapshot data
-     *
-     * @param array data
-     * @param array columnMap
-     */
-    public function setOldSnapshotData(array! data, columnMap = null)
-    {
-        var key, value, attribute;
-        array snapshot;
+            let insertData = model->prepareLowInsert(
+                metaData,
+                connection,
+                identityField
+            );
 
-        /**
-         * Build the snapshot based on a column map
+            if typeof upsert != "array" && insertData["generated"] {
+                let pending[] = ["insert", model, metaData, table, identityField];
+
+                continue;
+            }
+
+            if typeof table == "array" {
+                let table = table[0] . "." . table[1];
+            }
+
+            let batchKey = connectionId . ":" . table . ":" .
+                join(",", insertData["fields"]) . ":" .
+                join(",", insertData["bindTypes"]);
+
+            if !isset batches[batchKey] {
+                let conflictFields = null,
+                    updateFields   = null;
+
+                if typeof upsert == "array" {
+                    fetch conflictFields, upsert["conflictFields"];
+                    fetch updateFields, upsert["updateFields"];
+
+                    /**
+                     * Records clash on their primary key by default
+                     */
+                    if typeof conflictFields != "array" || !count(conflictFields) {
+                        let conflictFields = metaData->getPrimaryKeyAttributes(model);
+                    } else {
+                        let conflictFields = model->getColumnsOfAttributes(
+                            metaData,
+                            conflictFields
+                        );
+                    }
+
+                    if typeof updateFields == "array" {
+                        let updateFields = model->getColumnsOfAttributes(
+                            metaData,
+                            updateFields
+                        );
+                    }
+                }
+
+                let batches[batchKey] = [
+                    connection,
+                    table,
+                    insertData["fields"],
+                    insertData["bindTypes"],
+                    conflictFields,
+                    updateFields
+                ];
+
+                let batchRows[batchKey]   = [],
+                    batchModels[batchKey] = [];
+            }
+
+            let batchRows[batchKey][]   = insertData["values"],
+                batchModels[batchKey][] = [model, insertData];
+        }
+
+        for connection in connections {
+            connection->begin();
+        }
+
+        let failed = false;
+
+        try {
+            for batchKey, batch in batches {
+                let connection = batch[0];
+
+                if typeof upsert == "array" {
+                    let success = connection->upsertBatch(
+                        batch[1],
+                        batchRows[batchKey],
+                        batch[2],
+                        batch[4],
+                        batch[5],
+                        batch[3]
+                    );
+                } else {
+                    let success = connection->insertBatch(
+                        batch[1],
+                        batchRows[batchKey],
+                        batch[2],
+                        batch[3]
+                    );
+                }
+
+                if success === false {
+                    let failed = true;
+
+                    break;
+                }
+            }
+
+            if !failed {
+                for entry in pending {
+                    let model = entry[1];
+
+                    switch entry[0] {
+                        case "save":
+                            let success = model->doSave(new Collection());
+                            break;
+
+                        case "update":
+                            let success = model->doLowUpdate(
+                                entry[2],
+                                model->getWriteConnection(),
+                                entry[3]
+                            );
+                            break;
+
+                        default:
+                            let success = model->doLowInsert(
+                                entry[2],
+                                model->getWriteConnection(),
+                                entry[3],
+                                entry[4]
+                            );
+                    }
+
+                    if success === false {
+                        let failed = true;
+
+                        break;
+                    }
+                }
+            }
+        } catch Throwable, exception {
+            for connection in connections {
+                connection->rollback();
+            }
+
+            throw exception;
+        }
+
+        if failed {
+            for connection in connections {
+                connection->rollback();
+            }
+
+            for entry in pending {
+                if entry[0] != "save" {
+                    let model = entry[1];
+
+                    model->cancelOperation();
+                }
+            }
+
+            for batch in batchModels {
+                for entry in batch {
+                    let model = entry[0];
+
+                    model->cancelOperation();
+                }
+            }
+
+            return false;
+        }
+
+        for connection in connections {
+            connection->commit();
+        }
+
+        /**
+         * Update the state of the records inserted in batches, the same way
+         * doLowInsert() does
+         */
+        let saved = [];
+
+        for batch in batchModels {
+            for entry in batch {
+                let model      = entry[0],
+                    insertData = entry[1],
+                    snapshot   = insertData["snapshot"];
+
+                for attributeField, defaultValue in insertData["unsetDefaultValues"] {
+                    let model->{attributeField} = defaultValue;
+                }
+
+                let attributeField = insertData["identityAttribute"];
+
+                if attributeField !== null {
+                    if fetch value, model->{attributeField} {
+                        let snapshot[attributeField] = value;
+                    }
+
+                    let model->uniqueParams = null;
+                }
+
+                if model->getModelsManager()->isKeepingSnapshots(model) && globals_get("orm.update_snapshot_on_save") {
+                    let model->snapshot = snapshot;
+                }
+
+                let saved[] = [model, false];
+            }
+        }
+
+        for entry in pending {
+            if entry[0] != "save" {
+                let saved[] = [entry[1], entry[0] == "update"];
+            }
+        }
+
+        /**
+         * postSave() invokes after* events
+         */
+        for entry in saved {
+            let model = entry[0];
+
+            let model->dirtyState = self::DIRTY_STATE_PERSISTENT;
+
+            if globals_get("orm.events") {
+                model->postSave(true, entry[1]);
+            }
+
+            model->fireEvent("afterSave");
+        }
+
+        return true;
+    }
+
+    /**
+     * Serializes the object ignoring connections, services, related objects or
+     * static properties
+     */
+    public function serialize() -> string | null
+    {
+        /**
+         * Use the standard serialize function to serialize the array data
+         */
+        var attributes, manager, dirtyState, snapshot = null;
+
+        let attributes = this->toArray(null, false),
+            dirtyState = this->dirtyState,
+            manager = <ManagerInterface> this->getModelsManager();
+
+        if manager->isKeepingSnapshots(this) && this->snapshot != null && attributes != this->snapshot {
+            let snapshot = this->snapshot;
+        }
+
+        return serialize(
+            [
+                "attributes":  attributes,
+                "snapshot":    snapshot,
+                "dirtyState":  dirtyState
+            ]
+        );
+    }
+
+    /**
+     * Unserializes the object from a serialized string
+     */
+    public function unserialize(string data) -> void
+    {
+        var attributes, container, manager, key, value, snapshot, properties, dirtyState;
+
+        let attributes = unserialize(data);
+
+        if typeof attributes === "array" {
+            if !isset attributes["attributes"] {
+                let attributes = [
+                    "attributes": attributes
+                ];
+            }
+
+            /**
+             * Obtain the default DI
+             */
+            let container = Di::getDefault();
+            if container === null {
+                throw new Exception(
+                    "A dependency injection container is required to access the services related to the ODM in '" . get_class(this) . "'"
+                );
+            }
+
+            /**
+             * Update the dependency injector
+             */
+            let this->container = container;
+
+            /**
+             * Gets the default modelsManager service
+             */
+            let manager = <ManagerInterface> container->getShared("modelsManager");
+
+            if unlikely typeof manager !== "object" {
+                throw new Exception(
+                    "The injected service 'modelsManager' is not valid in '" . get_class(this) . "'"
+                );
+            }
+
+            /**
+             * Update the models manager
+             */
+            let this->modelsManager = manager;
+
+            /**
+             * Try to initialize the model
+             */
+            manager->initialize(this);
+
+            /**
+             * Fetch serialized props
+             */
+            if fetch properties, attributes["attributes"] {
+                /**
+                 * Update the objects properties
+                 */
+                for key, value in properties {
+                    let this->{key} = value;
+                }
+            } else {
+                let properties = [];
+            }
+
+            /**
+             * Fetch serialized dirtyState
+             */
+            if fetch dirtyState, attributes["dirtyState"] {
+                let this->dirtyState = dirtyState;
+            }
+
+            /**
+             * Fetch serialized snapshot when option is active
+             */
+            if manager->isKeepingSnapshots(this) {
+                if fetch snapshot, attributes["snapshot"] {
+                    let this->snapshot = snapshot;
+                } else {
+                    let this->snapshot = properties;
+                }
+            }
+        }
+    }
+
+    /**
+     * Sets the DependencyInjection connection service name
+     */
+    final public function setConnectionService(string! connectionService) -> void
+    {
+        (<ManagerInterface> this->modelsManager)->setConnectionService(
+            this,
+            connectionService
+        );
+    }
+
+    /**
+     * Sets the dirty state of the object using one of the DIRTY_STATE_* constants
+     */
+    public function setDirtyState(int dirtyState) -> <ModelInterface> | bool
+    {
+        let this->dirtyState = dirtyState;
+
+        return this;
+    }
+
+    /**
+     * Sets a custom events manager
+     */
+    public function setEventsManager(<EventsManagerInterface> eventsManager)
+    {
+        this->modelsManager->setCustomEventsManager(this, eventsManager);
+    }
+
+    /**
+     * Sets the DependencyInjection connection service name used to read data
+     */
+    final public function setReadConnectionService(string! connectionService) -> void
+    {
+        (<ManagerInterface> this->modelsManager)->setReadConnectionService(
+            this,
+            connectionService
+        );
+    }
+
+    /**
+     * Sets the record's old snapshot data.
+     * This method is used internally to set old snapshot data when the model
+     * was set up to keep snapshot data
+     *
+     * @param array data
+     * @param array columnMap
+     */
+    public function setOldSnapshotData(array! data, columnMap = null)
+    {
+        var key, value, attribute;
+        array snapshot;
+
+        /**
+         * Build the snapshot based on a column map
          */
         if typeof columnMap === "array" {
             let snapshot = [];
@@ -3123,7 +3667,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             exceptionOnFailedSave, exceptionOnFailedMetaDataSave, phqlLiterals,
             virtualForeignKeys, lateStateBinding, castOnHydrate,
             ignoreUnknownColumns, updateSnapshotOnSave, disableAssignSetters,
-            caseInsensitiveColumnMap, prefetchRecords, lastInsertId;
+            caseInsensitiveColumnMap, prefetchRecords, lastInsertId,
+            phqlCacheSize, phqlCacheMemory;
 
         /**
          * Enables/Disables globally the internal events
@@ -3218,6 +3763,18 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         if fetch lastInsertId, options["castLastInsertIdToInt"] {
             globals_set("orm.cast_last_insert_id_to_int", lastInsertId);
         }
+
+        /**
+         * Maximum number of entries in the persistent PHQL cache (0 disables
+         * it) and maximum memory in bytes used by its entries
+         */
+        if fetch phqlCacheSize, options["phqlCacheSize"] {
+            globals_set("orm.phql_cache_size", phqlCacheSize);
+        }
+
+        if fetch phqlCacheMemory, options["phqlCacheMemory"] {
+            globals_set("orm.phql_cache_memory", phqlCacheMemory);
+        }
     }
 
     /**
@@ -3759,169 +4316,12 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     protected function doLowInsert(<MetaDataInterface> metaData, <AdapterInterface> connection,
         table, identityField) -> bool
     {
-        var attributeField, attributes, automaticAttributes, bindDataTypes,
-            bindSkip, bindType, bindTypes, columnMap, defaultValue, defaultValues,
-            field, fields, lastInsertedId, manager, sequenceName, schema,
-            snapshot, source, success, unsetDefaultValues, value, values;
-        bool useExplicitIdentity;
-
-        let bindSkip            = Column::BIND_SKIP,
-            manager             = <ManagerInterface> this->modelsManager,
-            fields              = [],
-            values              = [],
-            snapshot            = [],
-            bindTypes           = [],
-            unsetDefaultValues  = [],
-            attributes          = metaData->getAttributes(this),
-            bindDataTypes       = metaData->getBindTypes(this),
-            automaticAttributes = metaData->getAutomaticCreateAttributes(this),
-            defaultValues       = metaData->getDefaultValues(this);
-
-        if globals_get("orm.column_renaming") {
-            let columnMap = metaData->getColumnMap(this);
-        } else {
-            let columnMap = null;
-        }
-
-        /**
-         * All fields in the model makes part or the INSERT
-         */
-        for field in attributes {
-            /**
-             * Check if the model has a column map
-             */
-            if typeof columnMap === "array" {
-                if unlikely !fetch attributeField, columnMap[field] {
-                    throw new Exception(
-                        "Column '" . field . "' in '" . get_class(this) . "' isn't part of the column map"
-                    );
-                }
-            } else {
-                let attributeField = field;
-            }
-
-            if !isset automaticAttributes[attributeField] {
-                /**
-                 * Check every attribute in the model except identity field
-                 */
-                if field != identityField {
-                    /**
-                     * This isset checks that the property be defined in the
-                     * model
-                     */
-                    if fetch value, this->{attributeField} {
-                        if value === null && isset defaultValues[field] {
-                            let snapshot[attributeField]           = defaultValues[field],
-                                unsetDefaultValues[attributeField] = defaultValues[field];
-
-                            if unlikely false === connection->supportsDefaultValue() {
-                                continue;
-                            }
-
-                            let value = connection->getDefaultValue();
-                        } else {
-                            let snapshot[attributeField] = value;
-                        }
-
-                        /**
-                         * Every column must have a bind data type defined
-                         */
-                        if unlikely !fetch bindType, bindDataTypes[field] {
-                            throw new Exception(
-                                "Column '" . field . "' in '" . get_class(this) . "' have not defined a bind data type"
-                            );
-                        }
-
-                        let fields[]    = field,
-                            values[]    = value,
-                            bindTypes[] = bindType;
-                    } else {
-                        if isset defaultValues[field] {
-                            let snapshot[attributeField]           = defaultValues[field],
-                                unsetDefaultValues[attributeField] = defaultValues[field];
-
-                            if unlikely false === connection->supportsDefaultValue() {
-                                continue;
-                            }
-
-                            let values[] = connection->getDefaultValue();
-                        } else {
-                            let values[]                 = value,
-                                snapshot[attributeField] = value;
-                        }
-
-                        let fields[]    = field,
-                            bindTypes[] = bindSkip;
-                    }
-                }
-            }
-        }
+        var attributeField, defaultValue, insertData, lastInsertedId, manager,
+            sequenceName, schema, snapshot, source, success;
 
-        /**
-         * If there is an identity field we add it using "null" or "default"
-         */
-        if identityField !== false {
-            let defaultValue = connection->getDefaultIdValue();
-
-            /**
-             * Not all the database systems require an explicit value for
-             * identity columns
-             */
-            let useExplicitIdentity = (bool) connection->useExplicitIdValue();
-
-            if useExplicitIdentity {
-                let fields[] = identityField;
-            }
-
-            /**
-             * Check if the model has a column map
-             */
-            if typeof columnMap == "array" {
-                if unlikely !fetch attributeField, columnMap[identityField] {
-                    throw new Exception(
-                        "Identity column '" . identityField . "' isn't part of the column map in '" . get_class(this) . "'"
-                    );
-                }
-            } else {
-                let attributeField = identityField;
-            }
-
-            /**
-             * Check if the developer set an explicit value for the column
-             */
-            if fetch value, this->{attributeField} {
-                if value === null || value === "" {
-                    if useExplicitIdentity {
-                        let values[] = defaultValue, bindTypes[] = bindSkip;
-                    }
-                } else {
-                    /**
-                     * Add the explicit value to the field list if the user has
-                     * defined a value for it
-                     */
-                    if !useExplicitIdentity {
-                        let fields[] = identityField;
-                    }
-
-                    /**
-                     * The field is valid we look for a bind value (normally int)
-                     */
-                    if unlikely !fetch bindType, bindDataTypes[identityField] {
-                        throw new Exception(
-                            "Identity column '" . identityField . "' isn\'t part of the table columns in '" . get_class(this) . "'"
-                        );
-                    }
-
-                    let values[]    = value,
-                        bindTypes[] = bindType;
-                }
-            } else {
-                if useExplicitIdentity {
-                    let values[]    = defaultValue,
-                        bindTypes[] = bindSkip;
-                }
-            }
-        }
+        let manager    = <ManagerInterface> this->modelsManager,
+            insertData = this->prepareLowInsert(metaData, connection, identityField),
+            snapshot   = insertData["snapshot"];
 
          /**
           * The insert will escape the table name
@@ -3933,9 +4333,16 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * The low level insert is performed
          */
-        let success = connection->insert(table, values, fields, bindTypes);
+        let success = connection->insert(
+            table,
+            insertData["values"],
+            insertData["fields"],
+            insertData["bindTypes"]
+        );
 
         if success && identityField !== false {
+            let attributeField = insertData["identityAttribute"];
+
             /**
              * We check if the model have sequences
              */
@@ -3984,7 +4391,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
              * written to the model attributes upon successful
              * insert.
              */
-            for attributeField, defaultValue in unsetDefaultValues {
+            for attributeField, defaultValue in insertData["unsetDefaultValues"] {
                 let this->{attributeField} = defaultValue;
             }
 
@@ -4287,8 +4694,120 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 let this->snapshot = newSnapshot;
             }
         }
-
-        return success;
+
+        return success;
+    }
+
+    /**
+     * Returns the columns of the passed attributes, through the column map
+     * of the model when there is one
+     */
+    protected function getColumnsOfAttributes(<MetaDataInterface> metaData, array! attributes) -> array
+    {
+        var attribute, column, reverseMap;
+        array columns;
+
+        if !globals_get("orm.column_renaming") {
+            return attributes;
+        }
+
+        let reverseMap = metaData->getReverseColumnMap(this);
+
+        if typeof reverseMap != "array" {
+            return attributes;
+        }
+
+        let columns = [];
+
+        for attribute in attributes {
+            if unlikely !fetch column, reverseMap[attribute] {
+                throw new Exception(
+                    "Column '" . attribute . "' in '" . get_class(this) . "' isn't part of the column map"
+                );
+            }
+
+            let columns[] = column;
+        }
+
+        return columns;
+    }
+
+    /**
+     * Eager loads relations into the related cache of the passed records,
+     * issuing one query per relation level instead of one query per record.
+     * Nested relations are separated by dots, e.g. "lines.product"
+     *
+     * @param ModelInterface[] records
+     * @param array|string     with
+     */
+    protected static function eagerLoad(array! records, var with) -> void
+    {
+        var record, manager, modelName, path, position, alias, nested,
+            relation, children;
+        array groups;
+
+        if !fetch record, records[0] {
+            return;
+        }
+
+        if typeof with == "string" {
+            let with = [with];
+        }
+
+        if unlikely typeof with != "array" {
+            throw new Exception(
+                "Relations to eager load must be a string or an array"
+            );
+        }
+
+        let manager   = <ManagerInterface> record->getModelsManager(),
+            modelName = get_class(record),
+            groups    = [];
+
+        /**
+         * Group the nested relations by the relation of this level
+         */
+        for path in with {
+            let position = strpos(path, ".");
+
+            if position === false {
+                let alias  = strtolower(path),
+                    nested = null;
+            } else {
+                let alias  = strtolower(substr(path, 0, position)),
+                    nested = substr(path, position + 1);
+            }
+
+            if !isset groups[alias] {
+                let groups[alias] = [];
+            }
+
+            if nested !== null && nested !== "" {
+                let groups[alias][] = nested;
+            }
+        }
+
+        for alias, nested in groups {
+            let relation = manager->getRelationByAlias(modelName, alias);
+
+            if unlikely typeof relation !== "object" {
+                throw new Exception(
+                    "There is no defined relations for the model '"
+                    . modelName . "' using alias '" . alias . "'"
+                );
+            }
+
+            let children = self::eagerLoadRelation(
+                manager,
+                relation,
+                alias,
+                records
+            );
+
+            if count(nested) > 0 {
+                self::eagerLoad(children, nested);
+            }
+        }
     }
 
     /**
@@ -4776,6 +5295,194 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return true;
     }
 
+    /**
+     * Collects the fields, values and bind types of the INSERT statement of
+     * the record, the snapshot to keep if it succeeds and whether the
+     * identity value has to be generated by the database system
+     *
+     * @param bool|string identityField
+     */
+    protected function prepareLowInsert(<MetaDataInterface> metaData, <AdapterInterface> connection, var identityField) -> array
+    {
+        var attributeField, attributes, automaticAttributes, bindDataTypes,
+            bindSkip, bindType, bindTypes, columnMap, defaultValue, defaultValues,
+            field, fields, snapshot, unsetDefaultValues, value, values;
+        bool generated, useExplicitIdentity;
+
+        let bindSkip            = Column::BIND_SKIP,
+            fields              = [],
+            values              = [],
+            snapshot            = [],
+            bindTypes           = [],
+            unsetDefaultValues  = [],
+            attributes          = metaData->getAttributes(this),
+            bindDataTypes       = metaData->getBindTypes(this),
+            automaticAttributes = metaData->getAutomaticCreateAttributes(this),
+            defaultValues       = metaData->getDefaultValues(this);
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(this);
+        } else {
+            let columnMap = null;
+        }
+
+        /**
+         * All fields in the model makes part or the INSERT
+         */
+        for field in attributes {
+            /**
+             * Check if the model has a column map
+             */
+            if typeof columnMap === "array" {
+                if unlikely !fetch attributeField, columnMap[field] {
+                    throw new Exception(
+                        "Column '" . field . "' in '" . get_class(this) . "' isn't part of the column map"
+                    );
+                }
+            } else {
+                let attributeField = field;
+            }
+
+            if !isset automaticAttributes[attributeField] {
+                /**
+                 * Check every attribute in the model except identity field
+                 */
+                if field != identityField {
+                    /**
+                     * This isset checks that the property be defined in the
+                     * model
+                     */
+                    if fetch value, this->{attributeField} {
+                        if value === null && isset defaultValues[field] {
+                            let snapshot[attributeField]           = defaultValues[field],
+                                unsetDefaultValues[attributeField] = defaultValues[field];
+
+                            if unlikely false === connection->supportsDefaultValue() {
+                                continue;
+                            }
+
+                            let value = connection->getDefaultValue();
+                        } else {
+                            let snapshot[attributeField] = value;
+                        }
+
+                        /**
+                         * Every column must have a bind data type defined
+                         */
+                        if unlikely !fetch bindType, bindDataTypes[field] {
+                            throw new Exception(
+                                "Column '" . field . "' in '" . get_class(this) . "' have not defined a bind data type"
+                            );
+                        }
+
+                        let fields[]    = field,
+                            values[]    = value,
+                            bindTypes[] = bindType;
+                    } else {
+                        if isset defaultValues[field] {
+                            let snapshot[attributeField]           = defaultValues[field],
+                                unsetDefaultValues[attributeField] = defaultValues[field];
+
+                            if unlikely false === connection->supportsDefaultValue() {
+                                continue;
+                            }
+
+                            let values[] = connection->getDefaultValue();
+                        } else {
+                            let values[]                 = value,
+                                snapshot[attributeField] = value;
+                        }
+
+                        let fields[]    = field,
+                            bindTypes[] = bindSkip;
+                    }
+                }
+            }
+        }
+
+        let attributeField = null,
+            generated      = false;
+
+        /**
+         * If there is an identity field we add it using "null" or "default"
+         */
+        if identityField !== false {
+            let generated    = true,
+                defaultValue = connection->getDefaultIdValue();
+
+            /**
+             * Not all the database systems require an explicit value for
+             * identity columns
+             */
+            let useExplicitIdentity = (bool) connection->useExplicitIdValue();
+
+            if useExplicitIdentity {
+                let fields[] = identityField;
+            }
+
+            /**
+             * Check if the model has a column map
+             */
+            if typeof columnMap == "array" {
+                if unlikely !fetch attributeField, columnMap[identityField] {
+                    throw new Exception(
+                        "Identity column '" . identityField . "' isn't part of the column map in '" . get_class(this) . "'"
+                    );
+                }
+            } else {
+                let attributeField = identityField;
+            }
+
+            /**
+             * Check if the developer set an explicit value for the column
+             */
+            if fetch value, this->{attributeField} {
+                if value === null || value === "" {
+                    if useExplicitIdentity {
+                        let values[] = defaultValue, bindTypes[] = bindSkip;
+                    }
+                } else {
+                    let generated = false;
+
+                    /**
+                     * Add the explicit value to the field list if the user has
+                     * defined a value for it
+                     */
+                    if !useExplicitIdentity {
+                        let fields[] = identityField;
+                    }
+
+                    /**
+                     * The field is valid we look for a bind value (normally int)
+                     */
+                    if unlikely !fetch bindType, bindDataTypes[identityField] {
+                        throw new Exception(
+                            "Identity column '" . identityField . "' isn\'t part of the table columns in '" . get_class(this) . "'"
+                        );
+                    }
+
+                    let values[]    = value,
+                        bindTypes[] = bindType;
+                }
+            } else {
+                if useExplicitIdentity {
+                    let values[]    = defaultValue,
+                        bindTypes[] = bindSkip;
+                }
+            }
+        }
+
+        return [
+            "fields"             : fields,
+            "values"             : values,
+            "bindTypes"          : bindTypes,
+            "snapshot"           : snapshot,
+            "unsetDefaultValues" : unsetDefaultValues,
+            "identityAttribute"  : attributeField,
+            "generated"          : generated
+        ];
+    }
+
     /**
      * Executes internal hooks before save a record
      *
@@ -5443,13 +6150,210 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         );
     }
 
+    /**
+     * Loads a relation for all the passed records and stores the results in
+     * their related cache. Returns the loaded records, used for the next
+     * level of nested relations
+     */
+    private static function eagerLoadRelation(
+        <ManagerInterface> manager,
+        <RelationInterface> relation,
+        string! alias,
+        array! records
+    ) -> array
+    {
+        var type, fields, referencedFields, referencedModel, extraParameters,
+            intermediateModel, intermediateFields, intermediateReferencedFields,
+            resultset, record, key, value, child, linked, group, related,
+            model, keepSnapshots;
+        array keys, links, linkedKeys, groups, children;
+        bool single;
+
+        let type             = relation->getType(),
+            fields           = relation->getFields(),
+            referencedFields = relation->getReferencedFields(),
+            referencedModel  = relation->getReferencedModel(),
+            extraParameters  = relation->getParams();
+
+        if unlikely typeof fields == "array" || typeof referencedFields == "array" {
+            throw new Exception(
+                "Relation '" . alias . "' uses compound keys and cannot be eager loaded"
+            );
+        }
+
+        /**
+         * A limit would apply to the records of all the parents at once
+         */
+        if typeof extraParameters == "array" {
+            if unlikely isset extraParameters["limit"] || isset extraParameters["offset"] {
+                throw new Exception(
+                    "Relation '" . alias . "' is limited and cannot be eager loaded"
+                );
+            }
+        } elseif typeof extraParameters == "string" {
+            let extraParameters = [extraParameters];
+        }
+
+        /**
+         * Collect the distinct keys of the parent records
+         */
+        let keys = [];
+
+        for record in records {
+            let value = record->readAttribute(fields);
+
+            if value !== null {
+                let keys[value] = value;
+            }
+        }
+
+        let groups   = [],
+            children = [];
+
+        if relation->isThrough() {
+            let intermediateModel            = relation->getIntermediateModel(),
+                intermediateFields           = relation->getIntermediateFields(),
+                intermediateReferencedFields = relation->getIntermediateReferencedFields();
+
+            if unlikely typeof intermediateFields == "array" || typeof intermediateReferencedFields == "array" {
+                throw new Exception(
+                    "Relation '" . alias . "' uses compound keys and cannot be eager loaded"
+                );
+            }
+
+            /**
+             * Map the referenced keys to the parent keys using the
+             * intermediate records
+             */
+            let links      = [],
+                linkedKeys = [];
+
+            if count(keys) > 0 {
+                let resultset = self::eagerLoadQuery(
+                    manager,
+                    intermediateModel,
+                    intermediateFields,
+                    keys
+                );
+
+                for record in iterator(resultset) {
+                    let key   = record->readAttribute(intermediateFields),
+                        value = record->readAttribute(intermediateReferencedFields);
+
+                    if value !== null {
+                        let links[value][]    = key,
+                            linkedKeys[value] = value;
+                    }
+                }
+            }
+
+            if count(linkedKeys) > 0 {
+                let resultset = self::eagerLoadQuery(
+                    manager,
+                    referencedModel,
+                    referencedFields,
+                    linkedKeys,
+                    extraParameters
+                );
+
+                for child in iterator(resultset) {
+                    let value = child->readAttribute(referencedFields);
+
+                    if fetch linked, links[value] {
+                        for key in linked {
+                            let groups[key][] = child;
+                        }
+
+                        let children[] = child;
+                    }
+                }
+            }
+        } elseif count(keys) > 0 {
+            let resultset = self::eagerLoadQuery(
+                manager,
+                referencedModel,
+                referencedFields,
+                keys,
+                extraParameters
+            );
+
+            for child in iterator(resultset) {
+                let value = child->readAttribute(referencedFields);
+
+                let groups[value][] = child,
+                    children[]      = child;
+            }
+        }
+
+        /**
+         * Single relations hold a record or null, the others a resultset
+         */
+        let single = type == Relation::BELONGS_TO || type == Relation::HAS_ONE || type == Relation::HAS_ONE_THROUGH,
+            model = null,
+            keepSnapshots = false;
+
+        if !single {
+            let model         = manager->load(referencedModel),
+                keepSnapshots = manager->isKeepingSnapshots(model);
+        }
+
+        for record in records {
+            let value = record->readAttribute(fields),
+                group = [];
+
+            if value !== null {
+                fetch group, groups[value];
+            }
+
+            if single {
+                if !fetch related, group[0] {
+                    let related = null;
+                }
+            } else {
+                let related = new Simple(null, model, false, null, keepSnapshots);
+
+                related->setRecords(group);
+            }
+
+            let record->related[alias]     = related,
+                record->eagerLoaded[alias] = value;
+        }
+
+        return children;
+    }
+
+    /**
+     * Queries the records of a model whose field is one of the passed keys
+     */
+    private static function eagerLoadQuery(
+        <ManagerInterface> manager,
+        string! modelName,
+        string! field,
+        array! keys,
+        var parameters = null
+    ) -> <ResultsetInterface>
+    {
+        var builder;
+
+        let builder = <BuilderInterface> manager->createBuilder(parameters);
+
+        builder->from(modelName);
+
+        builder->inWhere(
+            "[" . modelName . "].[" . field . "]",
+            array_values(keys)
+        );
+
+        return builder->getQuery()->execute();
+    }
+
     /**
      * shared prepare query logic for find and findFirst method
      */
     private static function getPreparedQuery(var params, var limit = null) -> <QueryInterface>
     {
         var builder, bindParams, bindTypes, transaction, cache, manager, query,
-            container;
+            container, stream;
 
         let container = Di::getDefault();
         let manager = <ManagerInterface> container->getShared("modelsManager");
@@ -5497,6 +6401,13 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             query->cache(cache);
         }
 
+        /**
+         * Stream the rows from the database instead of buffering them
+         */
+        if fetch stream, params["stream"] {
+            query->setStream(stream);
+        }
+
         return query;
     }
 
@@ -108,6 +108,21 @@ class Binder implements BinderInterface
         return {className}::findFirst(paramValue);
     }
 
+    /**
+     * Returns the model classes bound to the parameters of a handler, or null
+     * when the handler was not bound yet
+     */
+    public function getBindingPlan(string cacheKey) -> array | null
+    {
+        var bindingPlan;
+
+        if fetch bindingPlan, this->internalCache[cacheKey] {
+            return bindingPlan;
+        }
+
+        return null;
+    }
+
     /**
      * Return the active bound models
      *
@@ -249,6 +264,17 @@ class Binder implements BinderInterface
         return params;
     }
 
+    /**
+     * Sets the model classes bound to the parameters of a handler, so binding
+     * it skips the reflection
+     */
+    public function setBindingPlan(string cacheKey, array bindingPlan) -> <BinderInterface>
+    {
+        let this->internalCache[cacheKey] = bindingPlan;
+
+        return this;
+    }
+
     /**
      * Gets cache instance
      */
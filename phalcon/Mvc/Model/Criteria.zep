@@ -899,4 +899,21 @@ class Criteria implements CriteriaInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Sets the relations to eager load with the resultset. Nested relations
+     * are separated by dots
+     *
+     *```php
+     * $invoices = Invoices::query()
+     *     ->where("inv_status_flag = 1")
+     *     ->with(["customer", "lines.product"])
+     *     ->execute();
+     *```
+     */
+    public function with(array! relations) -> <CriteriaInterface>
+    {
+        let this->params["with"] = relations;
+
+        return this;
+    }
 }
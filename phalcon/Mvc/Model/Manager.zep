@@ -15,6 +15,7 @@ use Phalcon\Di\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface as EventsManagerInterface;
+use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Mvc\Model\Query\BuilderInterface;
@@ -2242,6 +2243,27 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
             this->keepSnapshots[entityName] = dynamicUpdate;
     }
 
+    /**
+     * Inserts several records or updates the existing rows they clash with,
+     * using multi-row INSERT statements with the ON DUPLICATE KEY UPDATE or
+     * ON CONFLICT clause of the dialect. The records are validated and their
+     * create events fired as with Model::saveMany(). See Model::upsertMany()
+     *
+     *```php
+     * $modelsManager->upsertMany($robots, ["code"], ["name", "year"]);
+     *```
+     *
+     * @param array|\Traversable $models
+     * @param array|null         $conflictFields
+     * @param array|null         $updateFields
+     *
+     * @return bool
+     */
+    public function upsertMany(var models, array conflictFields = null, array updateFields = null) -> bool
+    {
+        return Model::upsertMany(models, conflictFields, updateFields);
+    }
+
     /**
      * Returns the connection to read or write data related to a model
      * depending on the connection services.
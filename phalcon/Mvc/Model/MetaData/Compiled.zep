@@ -0,0 +1,231 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Mvc\Model\MetaData;
+
+use Phalcon\Mvc\Model\MetaData;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Support\Helper\File\MergeExported;
+
+/**
+ * Phalcon\Mvc\Model\MetaData\Compiled
+ *
+ * Stores the meta-data and column maps of all the models in a single
+ * generated PHP file that returns a constant array. With opcache enabled the
+ * array is kept immutable in shared memory, so loading it costs no
+ * deserialization and every read is a single hash lookup.
+ *
+ * New entries are kept in memory and added to the file once, by flush() or
+ * when the adapter is destroyed, while holding a lock on a sidecar
+ * ".lock" file, so concurrent workers merge their entries instead of
+ * overwriting each other.
+ *
+ *```php
+ * $metaData = new \Phalcon\Mvc\Model\MetaData\Compiled(
+ *     [
+ *         "metaDataFile" => "app/cache/metadata.php",
+ *     ]
+ * );
+ *```
+ */
+class Compiled extends MetaData
+{
+    /**
+     * @var array|null
+     */
+    protected compiled = null;
+
+    /**
+     * @var string
+     */
+    protected metaDataFile = "./metadata.php";
+
+    /**
+     * Entries written since the file was last updated
+     *
+     * @var array
+     */
+    protected pending = [];
+
+    /**
+     * Phalcon\Mvc\Model\MetaData\Compiled constructor
+     *
+     * @param array options
+     */
+    public function __construct(array options = [])
+    {
+        var metaDataFile;
+
+        if fetch metaDataFile, options["metaDataFile"] {
+            let this->metaDataFile = metaDataFile;
+        }
+    }
+
+    /**
+     * Adds the pending entries to the compiled file
+     */
+    public function __destruct()
+    {
+        this->flush();
+    }
+
+    /**
+     * Adds the pending entries to the compiled file. The file is reloaded
+     * under an exclusive lock, so the entries written by other workers are
+     * kept, and it is only rewritten when some entries are still missing.
+     * The new file is written to a temporary file first and renamed, so
+     * concurrent requests always include a complete file
+     */
+    public function flush() -> void
+    {
+        var compiled, pending;
+
+        if count(this->pending) === 0 {
+            return;
+        }
+
+        let pending       = this->pending,
+            this->pending = [];
+
+        let compiled = (new MergeExported())->__invoke(
+            this->metaDataFile,
+            function (compiled) use (pending) {
+                var data, key;
+
+                for key, data in pending {
+                    if !array_key_exists(key, compiled) {
+                        let compiled[key] = data;
+                    }
+                }
+
+                return compiled;
+            }
+        );
+
+        if unlikely false === compiled {
+            this->throwWriteException(
+                globals_get("orm.exception_on_failed_metadata_save")
+            );
+
+            return;
+        }
+
+        /**
+         * Keep the entries compiled by the other workers as well
+         */
+        let this->compiled = compiled;
+    }
+
+    /**
+     * Returns the path of the compiled file
+     */
+    public function getMetaDataFile() -> string
+    {
+        return this->metaDataFile;
+    }
+
+    /**
+     * Reads the meta-data from the compiled file
+     */
+    public function read(string! key) -> array | null
+    {
+        var data;
+
+        if this->compiled === null {
+            let this->compiled = this->loadFile(this->metaDataFile);
+        }
+
+        if fetch data, this->compiled[key] {
+            return data;
+        }
+
+        return null;
+    }
+
+    /**
+     * Removes the compiled file and resets internal meta-data in order to
+     * regenerate it
+     */
+    public function reset() -> void
+    {
+        var path;
+
+        let path = this->metaDataFile;
+
+        if file_exists(path) {
+            unlink(path);
+            this->invalidate(path);
+        }
+
+        let this->compiled = [],
+            this->pending  = [];
+
+        parent::reset();
+    }
+
+    /**
+     * Adds the meta-data to the pending entries of the compiled file
+     */
+    public function write(string! key, array data) -> void
+    {
+        if this->compiled === null {
+            let this->compiled = this->loadFile(this->metaDataFile);
+        }
+
+        let this->compiled[key] = data,
+            this->pending[key]  = data;
+    }
+
+    /**
+     * Drops the cached script from opcache after the file changed
+     */
+    private function invalidate(string! path) -> void
+    {
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(path, true);
+        }
+    }
+
+    /**
+     * Returns the array of the compiled file
+     */
+    private function loadFile(string! path) -> array
+    {
+        var compiled;
+
+        if !file_exists(path) {
+            return [];
+        }
+
+        let compiled = require path;
+
+        if typeof compiled != "array" {
+            return [];
+        }
+
+        return compiled;
+    }
+
+    /**
+     * Throws an exception when the metadata cannot be written
+     */
+    private function throwWriteException(var option) -> void
+    {
+        if option {
+            throw new Exception(
+                "Meta-Data file cannot be written"
+            );
+        } else {
+            trigger_error(
+                "Meta-Data file cannot be written"
+            );
+        }
+    }
+}
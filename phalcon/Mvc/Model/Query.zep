@@ -183,6 +183,11 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     protected sqlModelsAliases = [];
 
+    /**
+     * @var bool
+     */
+    protected stream = false;
+
     /**
      * @var int|null
      */
@@ -255,6 +260,15 @@ class Query implements QueryInterface, InjectionAwareInterface
         let self::internalPhqlCache = [];
     }
 
+    /**
+     * Destroys the persistent PHQL cache, shared by all the requests served by
+     * the current process, and resets its counters
+     */
+    public static function cleanPhqlCache() -> void
+    {
+        phalcon_orm_phql_cache_clear();
+    }
+
     /**
      * Executes a parsed PHQL statement
      *
@@ -269,6 +283,10 @@ class Query implements QueryInterface, InjectionAwareInterface
         let uniqueRow    = this->uniqueRow,
             cacheOptions = this->cacheOptions;
 
+        if unlikely this->stream && cacheOptions !== null {
+            throw new Exception("Streamed resultsets cannot be cached");
+        }
+
         if cacheOptions !== null {
             if unlikely typeof cacheOptions != "array" {
                 throw new Exception("Invalid caching options");
@@ -496,6 +514,21 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this->execute(bindParams, bindTypes)->getFirst();
     }
 
+    /**
+     * Returns the counters of the persistent PHQL cache: `entries`, `memory`
+     * (bytes), `hits`, `misses` and `evictions`.
+     *
+     * The persistent cache is enabled with the `phqlCacheSize` option of
+     * `Phalcon\Mvc\Model::setup()`. It keeps the parsed ASTs and the
+     * intermediate representations keyed by the full PHQL text across
+     * requests, so it must only be enabled when the models' sources and
+     * metadata do not change between requests.
+     */
+    public static function getPhqlCacheStats() -> array
+    {
+        return phalcon_orm_phql_cache_stats();
+    }
+
     /**
      * Returns the SQL to be generated by the internal PHQL (only works in
      * SELECT statements)
@@ -534,6 +567,14 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this->type;
     }
 
+    /**
+     * Check if the rows of the resultset are streamed from the database
+     */
+    public function getStream() -> bool
+    {
+        return this->stream;
+    }
+
     /**
      * Check if the query is programmed to get only the first row in the
      * resultset
@@ -560,7 +601,7 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     public function parse() -> array
     {
-        var intermediate, phql, ast, irPhql, uniqueId, type;
+        var intermediate, phql, ast, irPhql, uniqueId, type, cacheKey;
 
         let intermediate = this->intermediate;
 
@@ -575,7 +616,8 @@ class Query implements QueryInterface, InjectionAwareInterface
             ast = Lang::parsePHQL(phql);
 
         let irPhql = null,
-            uniqueId = null;
+            uniqueId = null,
+            cacheKey = null;
 
         if typeof ast == "array" {
             /**
@@ -593,6 +635,26 @@ class Query implements QueryInterface, InjectionAwareInterface
                 }
             }
 
+            /**
+             * Check if the prepared PHQL is in the persistent cache. The key
+             * is the full PHQL text since the representation depends on the
+             * implicit joins setting
+             */
+            if globals_get("orm.phql_cache_size") > 0 {
+                let cacheKey = (this->enableImplicitJoins ? "1" : "0") . phql,
+                    irPhql = phalcon_orm_phql_cache_get(cacheKey);
+
+                if typeof irPhql == "array" {
+                    let this->type = ast["type"];
+
+                    if typeof uniqueId == "int" {
+                        let self::internalPhqlCache[uniqueId] = irPhql;
+                    }
+
+                    return irPhql;
+                }
+            }
+
             /**
              * A valid AST must have a type
              */
@@ -636,6 +698,10 @@ class Query implements QueryInterface, InjectionAwareInterface
             let self::internalPhqlCache[uniqueId] = irPhql;
         }
 
+        if cacheKey !== null {
+            phalcon_orm_phql_cache_set(cacheKey, irPhql);
+        }
+
         let this->intermediate = irPhql;
 
         return irPhql;
@@ -725,6 +791,32 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Streams the rows of a SELECT from the database as the resultset is
+     * traversed, keeping the memory flat regardless of the number of rows.
+     * MySQL uses unbuffered queries and PostgreSQL server-side cursors.
+     *
+     * Streamed resultsets can only be traversed forward once, are not cached,
+     * and hydrate every row into the same record
+     *
+     *```php
+     * $invoices = $manager
+     *     ->createQuery("SELECT * FROM Invoices")
+     *     ->setStream(true)
+     *     ->execute();
+     *
+     * foreach ($invoices as $invoice) {
+     *     fputcsv($handle, $invoice->toArray());
+     * }
+     *```
+     */
+    public function setStream(bool stream) -> <QueryInterface>
+    {
+        let this->stream = stream;
+
+        return this;
+    }
+
     /**
      * allows to wrap a transaction around all queries
      */
@@ -1236,7 +1328,20 @@ class Query implements QueryInterface, InjectionAwareInterface
         /**
          * Execute the query
          */
-        let result = connection->query(sqlSelect, processed, processedTypes);
+        if this->stream {
+            /**
+             * queryStream() is not part of AdapterInterface
+             */
+            if unlikely !method_exists(connection, "queryStream") {
+                throw new Exception(
+                    "Streaming is not supported by the adapter " . get_class(connection)
+                );
+            }
+
+            let result = connection->queryStream(sqlSelect, processed, processedTypes);
+        } else {
+            let result = connection->query(sqlSelect, processed, processedTypes);
+        }
 
         /**
          * Check if the query has data
@@ -1336,7 +1441,8 @@ class Query implements QueryInterface, InjectionAwareInterface
                             resultObject,
                             resultData,
                             cache,
-                            isKeepingSnapshots
+                            isKeepingSnapshots,
+                            this->stream
                         ]
                     );
                 }
@@ -1350,7 +1456,8 @@ class Query implements QueryInterface, InjectionAwareInterface
                 resultObject,
                 resultData,
                 cache,
-                isKeepingSnapshots
+                isKeepingSnapshots,
+                this->stream
             );
         }
 
@@ -1360,7 +1467,8 @@ class Query implements QueryInterface, InjectionAwareInterface
         return new Complex(
             columns1,
             resultData,
-            cache
+            cache,
+            this->stream
         );
     }
 
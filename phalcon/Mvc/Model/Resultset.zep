@@ -122,6 +122,11 @@ abstract class Resultset
      */
     protected rows = null;
 
+    /**
+     * @var bool
+     */
+    protected stream = false;
+
     /**
      * Phalcon\Db\ResultInterface or false for empty resultset
      *
@@ -134,8 +139,9 @@ abstract class Resultset
      *
      * @param ResultInterface|false $result
      * @param mixed|null            $cache
+     * @param bool                  $stream
      */
-    public function __construct(var result, var cache = null)
+    public function __construct(var result, var cache = null, bool stream = false)
     {
         var prefetchRecords, rowCount, rows;
 
@@ -177,6 +183,16 @@ abstract class Resultset
          */
         result->setFetchMode(Enum::FETCH_ASSOC);
 
+        /**
+         * Streamed results are not counted nor prefetched, their rows are
+         * fetched one by one as the resultset is traversed forward
+         */
+        if stream {
+            let this->stream = true;
+
+            return;
+        }
+
         /**
          * Update the row-count
          */
@@ -211,10 +227,17 @@ abstract class Resultset
     }
 
     /**
-     * Counts how many rows are in the resultset
+     * Counts how many rows are in the resultset. Streamed resultsets are not
+     * counted up front and throw an exception
      */
     final public function count() -> int
     {
+        if unlikely this->stream {
+            throw new Exception(
+                "Streamed resultsets cannot be counted"
+            );
+        }
+
         return this->count;
     }
 
@@ -376,7 +399,7 @@ abstract class Resultset
      */
     public function getFirst() -> var | null
     {
-        if this->count == 0 {
+        if this->count == 0 && !this->stream {
             return null;
         }
 
@@ -400,6 +423,12 @@ abstract class Resultset
     {
         var count;
 
+        if unlikely this->stream {
+            throw new Exception(
+                "Streamed resultsets can only be traversed forward"
+            );
+        }
+
         let count = this->count;
 
         if count == 0 {
@@ -435,6 +464,14 @@ abstract class Resultset
         return this->isFresh;
     }
 
+    /**
+     * Tell if the rows of the resultset are streamed from the database
+     */
+    public function isStream() -> bool
+    {
+        return this->stream;
+    }
+
     /**
      * Returns serialised model objects as array for json_encode.
      * Calls jsonSerialize on each object if present
@@ -499,7 +536,7 @@ abstract class Resultset
      */
     public function offsetGet(mixed index) -> mixed
     {
-        if unlikely index >= this->count {
+        if unlikely !this->stream && index >= this->count {
             throw new Exception("The index does not exist in the cursor");
         }
 
@@ -508,6 +545,10 @@ abstract class Resultset
          */
         this->seek(index);
 
+        if unlikely !this->valid() {
+            throw new Exception("The index does not exist in the cursor");
+        }
+
         return this->{"current"}();
     }
 
@@ -554,6 +595,45 @@ abstract class Resultset
     {
         var result, row;
 
+        /**
+         * Streamed rows are fetched forward only, the result cannot be
+         * executed again to move backwards
+         */
+        if this->stream {
+            if this->pointer == position && this->row !== null {
+                return;
+            }
+
+            if unlikely position < this->pointer {
+                throw new Exception(
+                    "Streamed resultsets can only be traversed forward"
+                );
+            }
+
+            let result = this->result;
+
+            if this->row === null {
+                let this->row = result->$fetch();
+            }
+
+            while this->pointer < position && typeof this->row == "array" {
+                let this->row = result->$fetch();
+                let this->pointer++;
+            }
+
+            let this->pointer   = position,
+                this->activeRow = null;
+
+            /**
+             * Keep the number of rows read so far for offsetExists()
+             */
+            if typeof this->row == "array" {
+                let this->count = position + 1;
+            }
+
+            return;
+        }
+
         if this->pointer != position || this->row === null {
             if typeof this->rows == "array" {
                 /**
@@ -711,6 +791,10 @@ abstract class Resultset
      */
     public function valid() -> bool
     {
+        if this->stream {
+            return typeof this->row == "array";
+        }
+
         return this->pointer < this->count;
     }
 }
@@ -52,11 +52,13 @@ class Complex extends Resultset
      * @param array                $columnTypes
      * @param ResultInterface|null $result
      * @param mixed|null           $cache
+     * @param bool                 $stream
      */
     public function __construct(
         var columnTypes,
         <ResultInterface> result = null,
-        var cache = null
+        var cache = null,
+        bool stream = false
     )
     {
         /**
@@ -64,7 +66,7 @@ class Complex extends Resultset
          */
         let this->columnTypes = columnTypes;
 
-        parent::__construct(result, cache);
+        parent::__construct(result, cache, stream);
     }
 
     /**
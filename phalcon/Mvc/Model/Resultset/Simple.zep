@@ -15,6 +15,7 @@ use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Mvc\Model\ResultsetInterface;
 use Phalcon\Mvc\Model\Row;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Storage\Serializer\SerializerInterface;
@@ -45,6 +46,20 @@ class Simple extends Resultset
      */
     protected keepSnapshots = false;
 
+    /**
+     * Hydrated records kept in memory, set when relations are eager loaded
+     *
+     * @var array|null
+     */
+    protected records = null;
+
+    /**
+     * Record reused to hydrate every row of a streamed resultset
+     *
+     * @var ModelInterface|null
+     */
+    protected streamRecord = null;
+
     /**
      * Phalcon\Mvc\Model\Resultset\Simple constructor
      *
@@ -53,13 +68,15 @@ class Simple extends Resultset
      * @param \Phalcon\Db\ResultInterface|false result
      * @param mixed|null                        cache
      * @param bool keepSnapshots                false
+     * @param bool stream                       false
      */
     public function __construct(
         var columnMap,
         var model,
         result,
         var cache = null,
-        bool keepSnapshots = false
+        bool keepSnapshots = false,
+        bool stream = false
     )
     {
         let this->model     = model,
@@ -69,7 +86,7 @@ class Simple extends Resultset
          */
         let this->keepSnapshots = keepSnapshots;
 
-        parent::__construct(result, cache);
+        parent::__construct(result, cache, stream);
     }
 
     /**
@@ -86,6 +103,17 @@ class Simple extends Resultset
             return activeRow;
         }
 
+        /**
+         * Records with eager loaded relations are not hydrated again
+         */
+        if typeof this->records == "array" && this->hydrateMode == Resultset::HYDRATE_RECORDS {
+            if fetch activeRow, this->records[this->pointer] {
+                let this->activeRow = activeRow;
+
+                return activeRow;
+            }
+        }
+
         /**
          * Current row is set by seek() operations
          */
@@ -119,7 +147,22 @@ class Simple extends Resultset
                  * Set records as dirty state PERSISTENT by default
                  * Performs the standard hydration based on objects
                  */
-                if globals_get("orm.late_state_binding") {
+                if this->stream && this->model instanceof Model && !globals_get("orm.late_state_binding") {
+                    /**
+                     * Streamed rows are hydrated into the same record
+                     */
+                    if this->streamRecord === null {
+                        let this->streamRecord = clone this->model;
+                    }
+
+                    let activeRow = Model::assignResultMap(
+                        this->streamRecord,
+                        row,
+                        columnMap,
+                        Model::DIRTY_STATE_PERSISTENT,
+                        this->keepSnapshots
+                    );
+                } elseif globals_get("orm.late_state_binding") {
                     if this->model instanceof Model {
                         let modelName = get_class(this->model);
                     } else {
@@ -163,6 +206,44 @@ class Simple extends Resultset
         return activeRow;
     }
 
+    /**
+     * Keeps the passed hydrated records in memory, so every traversal of the
+     * resultset returns the same instances instead of hydrating the rows
+     * again. Used to keep the relations eager loaded into the records
+     *
+     * @param array records
+     */
+    public function setRecords(array! records) -> <ResultsetInterface>
+    {
+        var record;
+        array rows;
+
+        let records = array_values(records);
+
+        /**
+         * Rows streamed from the database are rebuilt from the records, which
+         * are already renamed by the column map
+         */
+        if typeof this->rows != "array" || count(this->rows) != count(records) {
+            let rows = [];
+
+            for record in records {
+                let rows[] = record->toArray();
+            }
+
+            let this->rows      = rows,
+                this->columnMap = null;
+        }
+
+        let this->records   = records,
+            this->count     = count(records),
+            this->pointer   = 0,
+            this->row       = null,
+            this->activeRow = null;
+
+        return this;
+    }
+
     /**
      * Returns a complete resultset as an array, if the resultset has a big
      * number of rows it could consume more memory than currently it does.
@@ -174,6 +255,12 @@ class Simple extends Resultset
         var result, records, record, renamedKey, key, value, columnMap;
         array renamedRecords, renamed;
 
+        if unlikely this->stream {
+            throw new Exception(
+                "Streamed resultsets cannot be exported to an array"
+            );
+        }
+
         /**
          * If _rows is not present, fetchAll from database
          * and keep them in memory for further operations
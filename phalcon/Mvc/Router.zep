@@ -58,6 +58,28 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
      */
     protected action = "";
 
+    /**
+     * Compiled matching buckets, keyed by HTTP method and hostname
+     *
+     * @var array|null
+     */
+    protected compiledBuckets = null;
+
+    /**
+     * @var int
+     */
+    protected compiledChunkSize = 32;
+
+    /**
+     * @var bool
+     */
+    protected compiledHostnames = false;
+
+    /**
+     * @var bool
+     */
+    protected compiledMatching = false;
+
     /**
      * @var string
      */
@@ -494,6 +516,8 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
                 throw new Exception("Invalid route position");
         }
 
+        let this->compiledBuckets = null;
+
         return this;
     }
 
@@ -502,7 +526,8 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
      */
     public function clear() -> void
     {
-        let this->routes = [];
+        let this->routes = [],
+            this->compiledBuckets = null;
     }
 
     /**
@@ -682,9 +707,10 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
     {
         var request, currentHostName, routeFound, parts, params, matches,
             notFoundPaths, vnamespace, module,  controller, action, paramsStr,
-            strParams, route, methods, container, hostname, regexHostName,
-            matched, pattern, handledUri, beforeMatch, paths, converters, part,
-            position, matchPosition, converter, eventsManager;
+            strParams, route, routes, methods, container, hostname,
+            regexHostName, matched, pattern, handledUri, beforeMatch, paths,
+            converters, part, position, matchPosition, converter, eventsManager;
+        int index;
 
         let uri = parse_url(uri, PHP_URL_PATH);
 
@@ -726,10 +752,24 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
 
         let request = <RequestInterface> container->get("request");
 
+        let routes = array_values(this->routes),
+            index = count(routes) - 1;
+
+        /**
+         * In compiled mode the routes that cannot match are skipped and the
+         * traversal starts from the first candidate
+         */
+        if this->compiledMatching && !this->hasRouteListeners() {
+            let index = this->matchCompiled(request, handledUri);
+        }
+
         /**
          * Routes are traversed in reversed order
          */
-        for route in reverse this->routes {
+        while index >= 0 {
+            let route = routes[index];
+            let index--;
+
             let params = [],
                 matches = null;
 
@@ -1018,6 +1058,14 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         }
     }
 
+    /**
+     * Returns whether the compiled matching mode is enabled
+     */
+    public function isCompiledMatching() -> bool
+    {
+        return this->compiledMatching;
+    }
+
     /**
      * Returns whether controller name should not be mangled
      */
@@ -1073,7 +1121,8 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
 
         let routes = this->routes;
 
-        let this->routes = array_merge(routes, groupRoutes);
+        let this->routes = array_merge(routes, groupRoutes),
+            this->compiledBuckets = null;
 
         return this;
     }
@@ -1113,6 +1162,44 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         return this;
     }
 
+    /**
+     * Enables or disables the compiled matching mode.
+     *
+     * When enabled, the routes are bucketed by HTTP method and hostname on the
+     * first call to `handle()`. Static routes are looked up by their pattern
+     * and the regular expression routes are merged in chunks of `chunkSize`
+     * alternatives, so that only the first candidate route (in reverse order)
+     * is checked. The matched route, its parameters and the `beforeMatch`
+     * callbacks behave exactly as in the default traversal.
+     *
+     * The compiled data is rebuilt after `add()`, `attach()`, `mount()` and
+     * `clear()`. Routes modified after the first `handle()` call require the
+     * mode to be set again. The default traversal is used while the events
+     * manager has listeners for `router:beforeCheckRoute` or
+     * `router:notMatchedRoute`, since those are fired for every route.
+     *
+     *```php
+     * $router->setCompiledMatching(true);
+     *```
+     *
+     * @param bool enabled
+     * @param int  chunkSize
+     *
+     * @return Router
+     */
+    public function setCompiledMatching(bool enabled, int chunkSize = 32) -> <Router>
+    {
+        if unlikely chunkSize < 1 {
+            throw new Exception("The chunk size must be greater than zero");
+        }
+
+        let this->compiledMatching = enabled,
+            this->compiledChunkSize = chunkSize,
+            this->compiledBuckets = null;
+
+        return this;
+    }
+
     /**
      * Sets the default action name
      *
@@ -1264,4 +1351,265 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
     {
         return this->wasMatched;
     }
+
+    /**
+     * Builds the compiled bucket for the current HTTP method and hostname.
+     * Routes that cannot be decided at compile time (regular expression
+     * hostnames, invalid HTTP methods, patterns that cannot be merged) are
+     * kept as single segments and checked by the default traversal.
+     */
+    protected function compileBucket(<RequestInterface> request, var currentHostName) -> array
+    {
+        var routes, route, methods, hostname, pattern, combinable, chunk,
+            chunkKey, staticRoutes, segments;
+        int index, chunkMax;
+        bool included;
+
+        let routes = array_values(this->routes),
+            staticRoutes = [],
+            segments = [],
+            chunk = [],
+            chunkKey = null,
+            chunkMax = -1,
+            index = count(routes);
+
+        while index > 0 {
+            let index--;
+            let route = routes[index];
+
+            /**
+             * Routes that do not accept the current method are never
+             * candidates. Invalid methods are left to the default traversal
+             * so that the exception is thrown at the same point
+             */
+            let combinable = true,
+                included = true,
+                methods = route->getHttpMethods();
+
+            if methods !== null {
+                try {
+                    let included = request->isMethod(methods, true);
+                } catch \Exception {
+                    let combinable = false;
+                }
+
+                if !included {
+                    continue;
+                }
+            }
+
+            let hostname = route->getHostName();
+            if hostname !== null {
+                if memstr(hostname, "(") {
+                    let combinable = false;
+                } elseif !currentHostName || currentHostName != hostname {
+                    continue;
+                }
+            }
+
+            let pattern = route->getCompiledPattern();
+
+            if combinable {
+                if !memstr(pattern, "^") {
+                    if !isset staticRoutes[pattern] {
+                        let staticRoutes[pattern] = index;
+                    }
+
+                    continue;
+                }
+
+                let combinable = this->getCombinablePattern(pattern);
+            }
+
+            if typeof combinable === "array" {
+                if chunkKey !== combinable[0] || count(chunk) >= this->compiledChunkSize {
+                    if count(chunk) > 0 {
+                        let segments[] = this->compileChunk(chunk, chunkKey, chunkMax);
+                    }
+
+                    let chunk = [],
+                        chunkKey = combinable[0],
+                        chunkMax = index;
+                }
+
+                let chunk[] = "(?:" . combinable[1] . ")(*MARK:" . index . ")";
+
+                continue;
+            }
+
+            if count(chunk) > 0 {
+                let segments[] = this->compileChunk(chunk, chunkKey, chunkMax);
+            }
+
+            let chunk = [],
+                chunkKey = null,
+                segments[] = [
+                    "max": index
+                ];
+        }
+
+        if count(chunk) > 0 {
+            let segments[] = this->compileChunk(chunk, chunkKey, chunkMax);
+        }
+
+        return [
+            "static":   staticRoutes,
+            "segments": segments
+        ];
+    }
+
+    /**
+     * Merges a chunk of regular expressions into one alternation. Each
+     * alternative records its route position with a `(*MARK)` verb
+     */
+    protected function compileChunk(array chunk, string chunkKey, int chunkMax) -> array
+    {
+        return [
+            "max":   chunkMax,
+            "regex": substr(chunkKey, 0, 1) . "(?|" . implode("|", chunk) . ")" . chunkKey
+        ];
+    }
+
+    /**
+     * Splits a compiled pattern into its delimiter/modifiers key and body.
+     * Returns false if the pattern cannot be merged with other patterns
+     * without changing its meaning (named or recursive groups, verbs,
+     * extended mode)
+     */
+    protected function getCombinablePattern(string pattern) -> array | bool
+    {
+        var delimiter, position, body, flags, part, parts;
+
+        let delimiter = substr(pattern, 0, 1);
+
+        if !memstr("#~/!@%|;,+", delimiter) {
+            return false;
+        }
+
+        let position = strrpos(pattern, delimiter);
+
+        if !position {
+            return false;
+        }
+
+        let body = substr(pattern, 1, position - 1),
+            flags = substr(pattern, position + 1);
+
+        if memstr(flags, "x") || memstr(body, "(*") {
+            return false;
+        }
+
+        let parts = explode("(?", body);
+
+        array_shift(parts);
+
+        for part in parts {
+            if !starts_with(part, ":") &&
+                !starts_with(part, "=") &&
+                !starts_with(part, "!") &&
+                !starts_with(part, "<=") &&
+                !starts_with(part, "<!") {
+                return false;
+            }
+        }
+
+        return [delimiter . flags, body];
+    }
+
+    /**
+     * Checks if there are listeners that expect to be notified for every
+     * route in the traversal
+     */
+    protected function hasRouteListeners() -> bool
+    {
+        var eventsManager;
+
+        let eventsManager = this->eventsManager;
+
+        if eventsManager === null {
+            return false;
+        }
+
+        return eventsManager->hasListeners("router") ||
+            eventsManager->hasListeners("router:beforeCheckRoute") ||
+            eventsManager->hasListeners("router:notMatchedRoute");
+    }
+
+    /**
+     * Returns the position of the first candidate route for the URI in
+     * reversed order, or -1 if no route can match
+     */
+    protected function matchCompiled(<RequestInterface> request, string handledUri) -> int
+    {
+        var route, currentHostName, key, bucket, segment, staticRoutes,
+            matches, matched, mark;
+        int candidate;
+
+        if this->compiledBuckets === null {
+            let this->compiledBuckets = [],
+                this->compiledHostnames = false;
+
+            for route in this->routes {
+                if route->getHostName() !== null {
+                    let this->compiledHostnames = true;
+
+                    break;
+                }
+            }
+        }
+
+        let currentHostName = null;
+
+        if this->compiledHostnames {
+            let currentHostName = request->getHttpHost();
+        }
+
+        let key = request->getMethod() . "|" . currentHostName;
+
+        if !fetch bucket, this->compiledBuckets[key] {
+            let bucket = this->compileBucket(request, currentHostName),
+                this->compiledBuckets[key] = bucket;
+        }
+
+        let candidate = -1,
+            staticRoutes = bucket["static"];
+
+        if isset staticRoutes[handledUri] {
+            let candidate = staticRoutes[handledUri];
+        }
+
+        for segment in bucket["segments"] {
+            if segment["max"] < candidate {
+                break;
+            }
+
+            /**
+             * Single routes are checked by the default traversal
+             */
+            if !isset segment["regex"] {
+                return segment["max"];
+            }
+
+            let matches = null,
+                matched = preg_match(segment["regex"], handledUri, matches);
+
+            if matched === false {
+                return segment["max"];
+            }
+
+            if matched {
+                if !fetch mark, matches["MARK"] {
+                    return segment["max"];
+                }
+
+                if (int) mark > candidate {
+                    return (int) mark;
+                }
+
+                return candidate;
+            }
+        }
+
+        return candidate;
+    }
 }
@@ -17,6 +17,7 @@ use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\View\Exception;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Mvc\View\Engine\Php as PhpEngine;
+use Phalcon\Support\Helper\File\MergeExported;
 
 /**
  * Phalcon\Mvc\View
@@ -43,6 +44,23 @@ use Phalcon\Mvc\View\Engine\Php as PhpEngine;
  * // Printing views output
  * echo $view->getContent();
  * ```
+ *
+ * The views directory and engine resolved for every view can be cached with
+ * the `pathCache` option, and kept across requests in a generated PHP file
+ * with the `pathCacheFile` option. The `pathCacheManifest` option discards
+ * that file whenever the given file, such as the manifest written by
+ * Phalcon\Mvc\View\Engine\Volt\Precompiler, is modified. The paths resolved
+ * during a request are added to the file once, by flushPathCache() or when
+ * the view is destroyed
+ *
+ * ```php
+ * $view = new View(
+ *     [
+ *         "pathCacheFile"     => "../app/cache/view-paths.php",
+ *         "pathCacheManifest" => "../app/compiled-templates/manifest.php",
+ *     ]
+ * );
+ * ```
  */
 class View extends Injectable implements ViewInterface, EventsAwareInterface
 {
@@ -151,6 +169,23 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
      */
     protected params = [];
 
+    /**
+     * @var array|null
+     */
+    protected pathCache = null;
+
+    /**
+     * @var int|null
+     */
+    protected pathCacheManifestTime = null;
+
+    /**
+     * Paths resolved since the `pathCacheFile` was last written
+     *
+     * @var array
+     */
+    protected pathCachePending = [];
+
     /**
      * @var array|null
      */
@@ -199,6 +234,23 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         let this->options = options;
     }
 
+    /**
+     * Writes the paths resolved during the request to the `pathCacheFile`
+     */
+    public function __destruct()
+    {
+        var e;
+
+        /**
+         * A destructor cannot throw, the failure is reported as an error
+         */
+        try {
+            this->flushPathCache();
+        } catch Exception, e {
+            trigger_error(e->getMessage());
+        }
+    }
+
     /**
      * Magic method to retrieve a variable passed to the view
      *
@@ -255,6 +307,34 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         return this;
     }
 
+    /**
+     * Removes the resolved view paths from memory and deletes the
+     * `pathCacheFile`
+     *
+     *```php
+     * $this->view->clearPathCache();
+     *```
+     */
+    public function clearPathCache() -> <View>
+    {
+        var cacheFile;
+
+        let this->pathCache        = null,
+            this->pathCachePending = [];
+
+        if fetch cacheFile, this->options["pathCacheFile"] {
+            if file_exists(cacheFile) {
+                unlink(cacheFile);
+
+                if function_exists("opcache_invalidate") {
+                    opcache_invalidate(cacheFile, true);
+                }
+            }
+        }
+
+        return this;
+    }
+
     /**
      * Disables a specific level of rendering
      *
@@ -315,6 +395,77 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         return this;
     }
 
+    /**
+     * Adds the paths resolved since the last call to the `pathCacheFile`.
+     * The file is reloaded while holding an exclusive lock on a sidecar
+     * ".lock" file, so the paths written by other workers are kept, and is
+     * only replaced when some paths changed
+     *
+     *```php
+     * $this->view->flushPathCache();
+     *```
+     */
+    public function flushPathCache() -> <View>
+    {
+        var cacheFile, data, manifest, pending;
+
+        if count(this->pathCachePending) === 0 {
+            return this;
+        }
+
+        if !fetch cacheFile, this->options["pathCacheFile"] {
+            let this->pathCachePending = [];
+
+            return this;
+        }
+
+        let pending                = this->pathCachePending,
+            this->pathCachePending = [],
+            manifest               = this->pathCacheManifestTime;
+
+        let data = (new MergeExported())->__invoke(
+            cacheFile,
+            function (data) use (pending, manifest) {
+                var cached, cacheKey, paths;
+
+                let paths = [];
+
+                /**
+                 * Discard the paths resolved before the manifest changed
+                 */
+                if isset data["paths"] && array_key_exists("manifest", data) {
+                    if data["manifest"] === manifest {
+                        let paths = data["paths"];
+                    }
+                }
+
+                for cacheKey, cached in pending {
+                    if !isset paths[cacheKey] || paths[cacheKey] !== cached {
+                        let paths[cacheKey] = cached;
+                    }
+                }
+
+                return [
+                    "manifest" : manifest,
+                    "paths"    : paths
+                ];
+            }
+        );
+
+        if unlikely false === data {
+            throw new Exception(
+                "The view path cache file '" . cacheFile . "' cannot be written"
+            );
+        }
+
+        /**
+         * Keep the paths resolved by the other workers as well
+         */
+        let this->pathCache = data["paths"];
+
+        return this;
+    }
+
     /**
      * Gets the name of the action rendered
      */
@@ -575,7 +726,7 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
      */
     public function has(string! view) -> bool
     {
-        var basePath, viewsDir, engines, extension;
+        var basePath, cached, viewsDir, engines, extension, pathCache;
 
         let basePath = this->basePath,
             engines  = this->registeredEngines;
@@ -588,6 +739,16 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
             this->registerEngines(engines);
         }
 
+        let pathCache = this->getPathCache();
+
+        if pathCache !== null {
+            if fetch cached, pathCache[this->getPathCacheKey(engines, view)] {
+                if file_exists(cached[1]) {
+                    return true;
+                }
+            }
+        }
+
         for viewsDir in this->getViewsDirs() {
             for extension, _ in engines {
                 if file_exists(basePath . viewsDir . view . extension) {
@@ -1053,14 +1214,38 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         bool silence,
         bool mustClean = true
     ) {
-        var basePath, engine, eventsManager, extension, viewsDir, viewsDirPath,
-            viewEnginePath, viewEnginePaths, viewParams;
+        var basePath, cached, cacheKey, engine, eventsManager, extension,
+            pathCache, viewsDir, viewsDirPath, viewEnginePath, viewEnginePaths;
 
         let basePath        = this->basePath,
-            viewParams      = this->viewParams,
             eventsManager   = <ManagerInterface> this->eventsManager,
+            pathCache       = this->getPathCache(),
+            cacheKey        = null,
             viewEnginePaths = [];
 
+        /**
+         * Render the path resolved by a previous lookup without checking
+         * every views directory and extension again
+         */
+        if pathCache !== null {
+            let cacheKey = this->getPathCacheKey(engines, viewPath);
+
+            /**
+             * A view deleted since it was cached falls back to the lookup
+             */
+            if fetch cached, pathCache[cacheKey] {
+                if file_exists(cached[1]) {
+                    if fetch engine, engines[cached[0]] {
+                        if this->renderEnginePath(engine, cached[1], mustClean) {
+                            return;
+                        }
+                    }
+                } else {
+                    unset this->pathCache[cacheKey];
+                }
+            }
+        }
+
         for viewsDir in this->getViewsDirs() {
             if !this->isAbsolutePath(viewPath) {
                 let viewsDirPath = basePath . viewsDir . viewPath;
@@ -1075,22 +1260,12 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
                 let viewEnginePath = viewsDirPath . extension;
 
                 if file_exists(viewEnginePath) {
-                    /**
-                     * Call beforeRenderView if there is an events manager
-                     * available
-                     */
-                    if typeof eventsManager === "object" {
-                        let this->activeRenderPaths = [viewEnginePath];
-
-                        if eventsManager->fire("view:beforeRenderView", this, viewEnginePath) === false {
-                            continue;
-                        }
+                    if !this->renderEnginePath(engine, viewEnginePath, mustClean) {
+                        continue;
                     }
 
-                    engine->render(viewEnginePath, viewParams, mustClean);
-
-                    if typeof eventsManager === "object" {
-                        eventsManager->fire("view:afterRenderView", this);
+                    if cacheKey !== null {
+                        this->addPathCache(cacheKey, extension, viewEnginePath);
                     }
 
                     return;
@@ -1116,6 +1291,63 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         }
     }
 
+    /**
+     * Returns the resolved view paths, loading the `pathCacheFile` the first
+     * time, or null when the path cache is disabled
+     */
+    protected function getPathCache() -> array | null
+    {
+        var cacheFile, data, enabled, manifestFile;
+
+        if this->pathCache !== null {
+            return this->pathCache;
+        }
+
+        if !fetch cacheFile, this->options["pathCacheFile"] {
+            if !fetch enabled, this->options["pathCache"] || !enabled {
+                return null;
+            }
+
+            let this->pathCache = [];
+
+            return this->pathCache;
+        }
+
+        let this->pathCache             = [],
+            this->pathCacheManifestTime = null;
+
+        if fetch manifestFile, this->options["pathCacheManifest"] {
+            if file_exists(manifestFile) {
+                let this->pathCacheManifestTime = filemtime(manifestFile);
+            }
+        }
+
+        if file_exists(cacheFile) {
+            let data = require cacheFile;
+
+            /**
+             * Discard the paths resolved before the manifest changed
+             */
+            if typeof data === "array" && isset data["paths"] && array_key_exists("manifest", data) {
+                if data["manifest"] === this->pathCacheManifestTime {
+                    let this->pathCache = data["paths"];
+                }
+            }
+        }
+
+        return this->pathCache;
+    }
+
+    /**
+     * Returns the key of a view path for the views directories and the
+     * extensions of the engines
+     */
+    protected function getPathCacheKey(array engines, string viewPath) -> string
+    {
+        return implode(",", array_keys(engines)) . "|" . this->basePath . "|" .
+            implode("|", this->getViewsDirs()) . "|" . viewPath;
+    }
+
     /**
      * Checks if a path is absolute or not
      */
@@ -1415,6 +1647,19 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         return true;
     }
 
+    /**
+     * Stores a resolved view path, added to the `pathCacheFile` by
+     * flushPathCache()
+     */
+    private function addPathCache(string! cacheKey, string! extension, string! viewEnginePath) -> void
+    {
+        let this->pathCache[cacheKey] = [extension, viewEnginePath];
+
+        if isset this->options["pathCacheFile"] {
+            let this->pathCachePending[cacheKey] = [extension, viewEnginePath];
+        }
+    }
+
     /**
      * @todo Remove this when we get traits
      */
@@ -1422,4 +1667,34 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
     {
         return rtrim(directory, DIRECTORY_SEPARATOR) . DIRECTORY_SEPARATOR;
     }
+
+    /**
+     * Renders a view with its engine, firing the view events. Returns false
+     * when beforeRenderView cancels the rendering
+     */
+    private function renderEnginePath(var engine, string! viewEnginePath, bool mustClean) -> bool
+    {
+        var eventsManager;
+
+        let eventsManager = <ManagerInterface> this->eventsManager;
+
+        /**
+         * Call beforeRenderView if there is an events manager available
+         */
+        if typeof eventsManager === "object" {
+            let this->activeRenderPaths = [viewEnginePath];
+
+            if eventsManager->fire("view:beforeRenderView", this, viewEnginePath) === false {
+                return false;
+            }
+        }
+
+        engine->render(viewEnginePath, this->viewParams, mustClean);
+
+        if typeof eventsManager === "object" {
+            eventsManager->fire("view:afterRenderView", this);
+        }
+
+        return true;
+    }
 }
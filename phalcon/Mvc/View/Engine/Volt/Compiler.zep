@@ -65,6 +65,13 @@ class Compiler implements InjectionAwareInterface
      */
     protected currentPath = null;
 
+    /**
+     * Templates included or extended by the last compiled template
+     *
+     * @var array
+     */
+    protected dependencies = [];
+
     /**
      * @var int
      */
@@ -296,6 +303,7 @@ class Compiler implements InjectionAwareInterface
         let this->foreachLevel = 0;
         let this->blockLevel = 0;
         let this->exprLevel = 0;
+        let this->dependencies = [];
 
         let compilation = null;
 
@@ -691,7 +699,7 @@ class Compiler implements InjectionAwareInterface
      */
     public function compileFile(string! path, string! compiledPath, bool extendsMode = false)
     {
-        var viewCode, compilation, finalCompilation;
+        var viewCode, compilation, finalCompilation, temporaryPath;
 
         if unlikely path == compiledPath {
             throw new Exception(
@@ -718,7 +726,8 @@ class Compiler implements InjectionAwareInterface
             );
         }
 
-        let this->currentPath = path;
+        let this->currentPath = path,
+            this->dependencies = [];
 
         let compilation = this->compileSource(viewCode, extendsMode);
 
@@ -733,12 +742,26 @@ class Compiler implements InjectionAwareInterface
 
         /**
          * Always use file_put_contents to write files instead of write the file
-         * directly, this respect the open_basedir directive
+         * directly, this respect the open_basedir directive. The file is
+         * written aside and renamed, so other processes never include a
+         * partially written template
          */
-        if unlikely file_put_contents(compiledPath, finalCompilation) === false {
+        let temporaryPath = compiledPath . "." . uniqid("", true) . ".tmp";
+
+        if unlikely file_put_contents(temporaryPath, finalCompilation) === false {
+            throw new Exception("Volt directory can't be written");
+        }
+
+        if unlikely !rename(temporaryPath, compiledPath) {
+            unlink(temporaryPath);
+
             throw new Exception("Volt directory can't be written");
         }
 
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(compiledPath, true);
+        }
+
         return compilation;
     }
 
@@ -1006,6 +1029,8 @@ class Compiler implements InjectionAwareInterface
                 let subCompiler = clone this;
                 let compilation = subCompiler->compile(finalPath, false);
 
+                this->addDependency(finalPath, subCompiler);
+
                 if compilation === null {
                     /**
                      * Use file-get-contents to respect the openbase_dir
@@ -2015,6 +2040,17 @@ class Compiler implements InjectionAwareInterface
         return this->compiledTemplatePath;
     }
 
+    /**
+     * Returns the templates included or extended by the last compiled
+     * template, including their own dependencies when they were compiled too
+     *
+     * @return string[]
+     */
+    public function getDependencies() -> array
+    {
+        return array_keys(this->dependencies);
+    }
+
     /**
      * Returns the internal dependency injector
      *
@@ -2774,6 +2810,8 @@ class Compiler implements InjectionAwareInterface
                         extended
                     );
 
+                    this->addDependency(finalPath, subCompiler);
+
                     /**
                      * If the compilation doesn't return anything we include the
                      * compiled path
@@ -2935,6 +2973,21 @@ class Compiler implements InjectionAwareInterface
         return statements;
     }
 
+    /**
+     * Records a template included or extended by the current template
+     */
+    private function addDependency(string! path, <Compiler> subCompiler) -> void
+    {
+        var dependency, dependencies;
+
+        let this->dependencies[path] = true,
+            dependencies             = subCompiler->getDependencies();
+
+        for dependency in dependencies {
+            let this->dependencies[dependency] = true;
+        }
+    }
+
     private function isTagFactory(array expression) -> bool
     {
         var left, leftValue, name;
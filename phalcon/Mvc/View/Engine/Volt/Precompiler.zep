@@ -0,0 +1,244 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Mvc\View\Engine\Volt;
+
+/**
+ * Phalcon\Mvc\View\Engine\Volt\Precompiler
+ *
+ * Compiles every Volt template of a set of directories ahead of time, for
+ * instance from a deployment script or a CLI task, so production can run
+ * with the `stat` option disabled. A manifest keeps the templates every
+ * template includes or extends, along with their modification times, so the
+ * next run only compiles the templates whose source or dependencies changed
+ *
+ *```php
+ * use Phalcon\Mvc\View\Engine\Volt\Compiler;
+ * use Phalcon\Mvc\View\Engine\Volt\Precompiler;
+ *
+ * $compiler = new Compiler($view);
+ *
+ * $compiler->setOptions(
+ *     [
+ *         "path" => "../app/compiled-templates/",
+ *     ]
+ * );
+ *
+ * $precompiler = new Precompiler($compiler);
+ *
+ * $compiled = $precompiler->compile(
+ *     [
+ *         "../app/views/",
+ *     ],
+ *     "../app/compiled-templates/manifest.php"
+ * );
+ *```
+ */
+class Precompiler
+{
+    /**
+     * @var Compiler
+     */
+    protected compiler;
+
+    /**
+     * @var string
+     */
+    protected extension;
+
+    /**
+     * Phalcon\Mvc\View\Engine\Volt\Precompiler constructor
+     */
+    public function __construct(<Compiler> compiler, string! extension = ".volt")
+    {
+        let this->compiler  = compiler,
+            this->extension = extension;
+    }
+
+    /**
+     * Compiles the templates of the directories that changed since the
+     * manifest was written and writes the manifest again. Returns the
+     * compiled templates
+     *
+     * @param array  directories
+     * @param string manifestPath
+     *
+     * @return string[]
+     * @throws Exception
+     */
+    public function compile(array! directories, string! manifestPath) -> array
+    {
+        var compiler, dependencies, dependency, directory, entry, manifest,
+            mtimes, paths, templatePath, templates;
+        array compiled, newMtimes, newTemplates;
+
+        clearstatcache();
+
+        let manifest     = this->readManifest(manifestPath),
+            templates    = manifest["templates"],
+            mtimes       = manifest["mtimes"],
+            compiled     = [],
+            newMtimes    = [],
+            newTemplates = [];
+
+        for directory in directories {
+            let paths = this->getTemplates(directory);
+
+            for templatePath in paths {
+                if !this->isFresh(templatePath, templates, mtimes) {
+                    /**
+                     * Compile the template and its dependencies again
+                     */
+                    let compiler = clone this->compiler;
+
+                    compiler->setOption("always", true);
+                    compiler->compile(templatePath);
+
+                    let templates[templatePath] = [
+                        "compiled"     : compiler->getCompiledTemplatePath(),
+                        "dependencies" : compiler->getDependencies()
+                    ];
+
+                    let compiled[] = templatePath;
+                }
+
+                let entry                      = templates[templatePath],
+                    dependencies               = entry["dependencies"],
+                    newTemplates[templatePath] = entry,
+                    newMtimes[templatePath]    = filemtime(templatePath);
+
+                for dependency in dependencies {
+                    if file_exists(dependency) {
+                        let newMtimes[dependency] = filemtime(dependency);
+                    }
+                }
+            }
+        }
+
+        this->writeManifest(
+            manifestPath,
+            [
+                "templates" : newTemplates,
+                "mtimes"    : newMtimes
+            ]
+        );
+
+        return compiled;
+    }
+
+    /**
+     * Returns the templates of a directory and its subdirectories
+     */
+    protected function getTemplates(string! directory) -> array
+    {
+        var file, filePath, scanner;
+        array templates;
+
+        let templates = [];
+
+        if !is_dir(directory) {
+            throw new Exception(
+                "Views directory " . directory . " does not exist"
+            );
+        }
+
+        let scanner = new \RecursiveIteratorIterator(
+            new \RecursiveDirectoryIterator(
+                directory,
+                \FilesystemIterator::SKIP_DOTS
+            )
+        );
+
+        for file in iterator(scanner) {
+            let filePath = file->getPathname();
+
+            if file->isFile() && ends_with(filePath, this->extension) {
+                let templates[] = filePath;
+            }
+        }
+
+        sort(templates);
+
+        return templates;
+    }
+
+    /**
+     * Whether the compiled template is newer than the template and all the
+     * templates it depends on
+     */
+    protected function isFresh(string! templatePath, array! templates, array! mtimes) -> bool
+    {
+        var dependency, dependencies, entry, mtime;
+
+        if !fetch entry, templates[templatePath] {
+            return false;
+        }
+
+        if !file_exists(entry["compiled"]) {
+            return false;
+        }
+
+        let dependencies   = entry["dependencies"],
+            dependencies[] = templatePath;
+
+        for dependency in dependencies {
+            if !fetch mtime, mtimes[dependency] {
+                return false;
+            }
+
+            if !file_exists(dependency) || filemtime(dependency) !== mtime {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Reads the manifest written by the previous run
+     */
+    protected function readManifest(string! manifestPath) -> array
+    {
+        var manifest;
+
+        if file_exists(manifestPath) {
+            let manifest = require manifestPath;
+
+            if typeof manifest == "array" && isset manifest["templates"] && isset manifest["mtimes"] {
+                return manifest;
+            }
+        }
+
+        return [
+            "templates" : [],
+            "mtimes"    : []
+        ];
+    }
+
+    /**
+     * Writes the manifest to a temporary file and renames it
+     */
+    protected function writeManifest(string! manifestPath, array! manifest) -> void
+    {
+        var temporaryPath;
+
+        let temporaryPath = manifestPath . "." . uniqid("", true) . ".tmp";
+
+        if unlikely file_put_contents(temporaryPath, "<?php return " . var_export(manifest, true) . ";\n") === false {
+            throw new Exception("Volt directory can't be written");
+        }
+
+        if unlikely !rename(temporaryPath, manifestPath) {
+            unlink(temporaryPath);
+
+            throw new Exception("Volt directory can't be written");
+        }
+    }
+}
@@ -10,6 +10,8 @@
 
 namespace Phalcon\Paginator\Adapter;
 
+use Phalcon\Cache\Adapter\AdapterInterface as CacheAdapterInterface;
+use Phalcon\Cache\CacheInterface;
 use Phalcon\Paginator\Exception;
 use Phalcon\Paginator\Repository;
 use Phalcon\Paginator\RepositoryInterface;
@@ -50,10 +52,27 @@ abstract class AbstractAdapter implements AdapterInterface
     /**
      * Phalcon\Paginator\Adapter\AbstractAdapter constructor
      *
+     * The totals counted by the adapters are cached with the `countCache`
+     * option, an instance of Phalcon\Cache\CacheInterface or
+     * Phalcon\Cache\Adapter\AdapterInterface, along with the optional
+     * `countCacheKey` and `countCacheLifetime` options
+     *
      * @param array $config
      */
     public function __construct(array! config)
     {
+        var countCache;
+
+        if fetch countCache, config["countCache"] {
+            if unlikely !(countCache instanceof CacheInterface) && !(countCache instanceof CacheAdapterInterface) {
+                throw new Exception(
+                    "Parameter 'countCache' must be an instance of " .
+                    "Phalcon\\Cache\\CacheInterface or " .
+                    "Phalcon\\Cache\\Adapter\\AdapterInterface"
+                );
+            }
+        }
+
         let this->config = config;
 
         if isset config["limit"] {
@@ -116,6 +135,29 @@ abstract class AbstractAdapter implements AdapterInterface
         return this;
     }
 
+    /**
+     * Returns the total of rows stored in the `countCache` for the source of
+     * data, or null when it is missing or the option is not set
+     */
+    protected function getCachedCount(string! source) -> int | null
+    {
+        var countCache, rowcount;
+
+        if !fetch countCache, this->config["countCache"] {
+            return null;
+        }
+
+        let rowcount = countCache->get(
+            this->getCountCacheKey(source)
+        );
+
+        if typeof rowcount !== "integer" {
+            return null;
+        }
+
+        return rowcount;
+    }
+
     /**
      * Gets current repository for pagination
      */
@@ -131,4 +173,42 @@ abstract class AbstractAdapter implements AdapterInterface
 
         return this->repository;
     }
+
+    /**
+     * Stores the total of rows of the source of data in the `countCache`, if
+     * the option is set
+     */
+    protected function setCachedCount(string! source, int rowcount) -> void
+    {
+        var countCache, lifetime;
+
+        if !fetch countCache, this->config["countCache"] {
+            return;
+        }
+
+        if !fetch lifetime, this->config["countCacheLifetime"] {
+            let lifetime = null;
+        }
+
+        countCache->set(
+            this->getCountCacheKey(source),
+            rowcount,
+            lifetime
+        );
+    }
+
+    /**
+     * Returns the `countCacheKey` option or a key derived from the source of
+     * data
+     */
+    private function getCountCacheKey(string! source) -> string
+    {
+        var countCacheKey;
+
+        if fetch countCacheKey, this->config["countCacheKey"] {
+            return countCacheKey;
+        }
+
+        return "_PHPC_" . md5(get_class(this) . source);
+    }
 }
@@ -0,0 +1,391 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Paginator\Adapter;
+
+use Phalcon\Mvc\Model\Query\Builder;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\Repository;
+use Phalcon\Paginator\RepositoryInterface;
+
+/**
+ * Phalcon\Paginator\Adapter\Keyset
+ *
+ * Pagination using a PHQL query builder as source of data, seeking on an
+ * ordered unique tuple of columns instead of using an offset, so deep pages
+ * cost the same as the first one and no total is counted. The pages are
+ * identified by opaque cursors returned in the repository
+ *
+ * ```php
+ * use Phalcon\Paginator\Adapter\Keyset;
+ *
+ * $builder = $this->modelsManager->createBuilder()
+ *                 ->from(Robots::class);
+ *
+ * $paginator = new Keyset(
+ *     [
+ *         "builder" => $builder,
+ *         "columns" => ["year", "id"],
+ *         "limit"   => 20,
+ *         "cursor"  => $this->request->getQuery("cursor"),
+ *     ]
+ * );
+ *
+ * $page = $paginator->paginate();
+ *
+ * $next = $page->getNextCursor();
+ *```
+ */
+class Keyset extends AbstractAdapter
+{
+    /**
+     * Paginator's data
+     *
+     * @var Builder
+     */
+    protected builder;
+
+    /**
+     * Unique tuple of columns the rows are ordered by
+     *
+     * @var array
+     */
+    protected columns = [];
+
+    /**
+     * Cursor of the page to return
+     *
+     * @var string|null
+     */
+    protected cursor = null;
+
+    /**
+     * Whether the rows are ordered descending
+     *
+     * @var bool
+     */
+    protected descending = false;
+
+    /**
+     * Phalcon\Paginator\Adapter\Keyset
+     *
+     * @param array config = [
+     *     'limit'   => 10,
+     *     'builder' => null,
+     *     'columns' => [],
+     *     'cursor'  => null,
+     *     'order'   => 'ASC'
+     * ]
+     */
+    public function __construct(array config)
+    {
+        var builder, columns, cursor, order;
+
+        if unlikely !isset config["limit"] {
+            throw new Exception("Parameter 'limit' is required");
+        }
+
+        if unlikely !fetch builder, config["builder"] {
+            throw new Exception("Parameter 'builder' is required");
+        }
+
+        if unlikely !(builder instanceof Builder) {
+            throw new Exception(
+                "Parameter 'builder' must be an instance " .
+                "of Phalcon\\Mvc\\Model\\Query\\Builder"
+            );
+        }
+
+        if unlikely !fetch columns, config["columns"] {
+            throw new Exception("Parameter 'columns' is required");
+        }
+
+        if typeof columns === "string" {
+            let columns = [columns];
+        }
+
+        if unlikely typeof columns !== "array" || empty columns {
+            throw new Exception(
+                "Parameter 'columns' must be a non empty array"
+            );
+        }
+
+        if fetch order, config["order"] {
+            let this->descending = strtoupper(order) === "DESC";
+        }
+
+        if fetch cursor, config["cursor"] {
+            this->setCursor(cursor);
+        }
+
+        let this->columns = array_values(columns);
+
+        parent::__construct(config);
+
+        this->setQueryBuilder(builder);
+    }
+
+    /**
+     * Get the cursor of the page to return
+     */
+    public function getCursor() -> string | null
+    {
+        return this->cursor;
+    }
+
+    /**
+     * Get query builder object
+     */
+    public function getQueryBuilder() -> <Builder>
+    {
+        return this->builder;
+    }
+
+    /**
+     * Returns the rows following the cursor, or the first rows without it,
+     * along with the cursors of the next and previous pages
+     */
+    public function paginate() -> <RepositoryInterface>
+    {
+        var builder, column, columns, cursor, direction, hasMore, item, items,
+            last, limit, next, previous, values;
+        array orderBy, rows;
+        bool backwards, descending;
+
+        let columns    = this->columns,
+            descending = this->descending,
+            limit      = this->limitRows,
+            backwards  = false,
+            values     = null;
+
+        /**
+         * We make a copy of the original builder to leave it as it is
+         */
+        let builder = clone this->builder;
+
+        if this->cursor !== null {
+            let cursor    = this->decodeCursor(this->cursor),
+                direction = cursor[0],
+                values    = cursor[1],
+                backwards = direction === "p";
+
+            builder->andWhere(
+                this->getSeekConditions(columns, descending !== backwards),
+                this->getSeekBindParams(values)
+            );
+        }
+
+        /**
+         * Pages before the cursor are read in the opposite order
+         */
+        let orderBy = [];
+
+        for column in columns {
+            let orderBy[] = column . ((descending !== backwards) ? " DESC" : " ASC");
+        }
+
+        builder->orderBy(implode(", ", orderBy));
+
+        /**
+         * One more row tells whether there is a page after this one
+         */
+        builder->limit(limit + 1);
+
+        let rows = [];
+        let items = builder->getQuery()->execute();
+
+        for item in iterator(items) {
+            let rows[] = item;
+        }
+
+        let hasMore = count(rows) > limit;
+
+        if hasMore {
+            array_pop(rows);
+        }
+
+        if backwards {
+            let rows = array_reverse(rows);
+        }
+
+        let next     = null,
+            previous = null;
+
+        if !empty rows {
+            let last = count(rows) - 1;
+
+            if backwards {
+                let next = this->encodeCursor("n", this->getCursorValues(rows[last]));
+
+                if hasMore {
+                    let previous = this->encodeCursor("p", this->getCursorValues(rows[0]));
+                }
+            } else {
+                if hasMore {
+                    let next = this->encodeCursor("n", this->getCursorValues(rows[last]));
+                }
+
+                if this->cursor !== null {
+                    let previous = this->encodeCursor("p", this->getCursorValues(rows[0]));
+                }
+            }
+        }
+
+        return this->getRepository(
+            [
+                RepositoryInterface::PROPERTY_ITEMS  : rows,
+                RepositoryInterface::PROPERTY_LIMIT  : this->limitRows,
+                Repository::PROPERTY_NEXT_CURSOR     : next,
+                Repository::PROPERTY_PREVIOUS_CURSOR : previous
+            ]
+        );
+    }
+
+    /**
+     * Set the cursor of the page to return, null for the first page
+     */
+    public function setCursor(string cursor = null) -> <Keyset>
+    {
+        if cursor === "" {
+            let cursor = null;
+        }
+
+        let this->cursor = cursor;
+
+        return this;
+    }
+
+    /**
+     * Set query builder object
+     */
+    public function setQueryBuilder(<Builder> builder) -> <Keyset>
+    {
+        let this->builder = builder;
+
+        return this;
+    }
+
+    /**
+     * Returns the direction and the column values of a cursor
+     */
+    protected function decodeCursor(string! cursor) -> array
+    {
+        var decoded;
+
+        let decoded = base64_decode(strtr(cursor, "-_", "+/"), true);
+
+        if decoded !== false {
+            let decoded = json_decode(decoded, true);
+        }
+
+        if unlikely typeof decoded !== "array" || !isset decoded[0] || !isset decoded[1] {
+            throw new Exception("The cursor is not valid");
+        }
+
+        if unlikely !in_array(decoded[0], ["n", "p"], true) || typeof decoded[1] !== "array" || count(decoded[1]) !== count(this->columns) {
+            throw new Exception("The cursor is not valid");
+        }
+
+        return decoded;
+    }
+
+    /**
+     * Returns an opaque cursor for the direction and the column values
+     */
+    protected function encodeCursor(string! direction, array! values) -> string
+    {
+        return rtrim(
+            strtr(base64_encode(json_encode([direction, values])), "+/", "-_"),
+            "="
+        );
+    }
+
+    /**
+     * Returns the values of the cursor columns of a row
+     */
+    protected function getCursorValues(var row) -> array
+    {
+        var column, columns, position, property;
+        array values;
+
+        let columns = this->columns,
+            values  = [];
+
+        for column in columns {
+            /**
+             * Qualified columns are read by their attribute name
+             */
+            let position = strrpos(column, ".");
+
+            if position !== false {
+                let property = substr(column, position + 1);
+            } else {
+                let property = column;
+            }
+
+            let property = trim(property, "[]");
+
+            if typeof row === "array" {
+                let values[] = row[property];
+            } else {
+                let values[] = row->{property};
+            }
+        }
+
+        return values;
+    }
+
+    /**
+     * Returns the bind parameters of the seek conditions
+     */
+    protected function getSeekBindParams(array! values) -> array
+    {
+        var position, value;
+        array bindParams;
+
+        let bindParams = [],
+            values     = array_values(values);
+
+        for position, value in values {
+            let bindParams["PHK" . position] = value;
+        }
+
+        return bindParams;
+    }
+
+    /**
+     * Returns the conditions seeking past the cursor values. Each column is
+     * compared only when the previous ones are equal, which is the expanded
+     * form of `(a, b) > (:a, :b)`
+     */
+    protected function getSeekConditions(array! columns, bool descending) -> string
+    {
+        var column, operator, position;
+        array conditions, equals;
+
+        let conditions = [],
+            equals     = [],
+            operator   = descending ? " < " : " > ";
+
+        for position, column in columns {
+            let conditions[] = "(" . implode(
+                " AND ",
+                array_merge(
+                    equals,
+                    [column . operator . ":PHK" . position . ":"]
+                )
+            ) . ")";
+
+            let equals[] = column . " = :PHK" . position . ":";
+        }
+
+        return implode(" OR ", conditions);
+    }
+}
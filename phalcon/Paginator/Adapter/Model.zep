@@ -80,6 +80,16 @@ use Phalcon\Paginator\RepositoryInterface;
  * );
  *
  * $paginate = $paginator->paginate();
+ *
+ * $paginator = new Model(
+ *     [
+ *         "model"              => Robots::class,
+ *         "limit"              => 8,
+ *         "page"               => $currentPage,
+ *         "countCache"         => $cache,
+ *         "countCacheLifetime" => 300,
+ *     ]
+ * );
  *```
  */
 class Model extends AbstractAdapter
@@ -89,8 +99,8 @@ class Model extends AbstractAdapter
      */
     public function paginate() -> <RepositoryInterface>
     {
-        var config, modelClass, parameters, rowCountResult,
-         pageItems = [];
+        var config, modelClass, parameters, rowCountResult, cachedCount,
+            countSource, pageItems = [];
         int pageNumber, limit, rowcount, next, totalPages,
             previous;
 
@@ -112,13 +122,32 @@ class Model extends AbstractAdapter
             let pageNumber = 1;
         }
 
-        // This can return int or ResultsetInterface if it's grouped
-        let rowCountResult = call_user_func([modelClass, "count"], parameters);
+        /**
+         * The total is read from the count cache, if any
+         */
+        let cachedCount = null,
+            countSource = null;
+
+        if isset config["countCache"] {
+            let countSource = modelClass . serialize(parameters),
+                cachedCount = this->getCachedCount(countSource);
+        }
 
-        if typeof rowCountResult == "object" {
-            let rowcount = (int) rowCountResult->count();
+        if cachedCount !== null {
+            let rowcount = (int) cachedCount;
         } else {
-            let rowcount = (int) rowCountResult;
+            // This can return int or ResultsetInterface if it's grouped
+            let rowCountResult = call_user_func([modelClass, "count"], parameters);
+
+            if typeof rowCountResult == "object" {
+                let rowcount = (int) rowCountResult->count();
+            } else {
+                let rowcount = (int) rowCountResult;
+            }
+
+            if countSource !== null {
+                this->setCachedCount(countSource, rowcount);
+            }
         }
 
         if rowcount % limit != 0 {
@@ -59,7 +59,11 @@ class QueryBuilder extends AbstractAdapter
      * @param array config = [
      *     'limit' => 10,
      *     'builder' => null,
-     *     'columns' => ''
+     *     'columns' => '',
+     *     'countCache' => null,
+     *     'countCacheKey' => null,
+     *     'countCacheLifetime' => null,
+     *     'countEstimate' => false
      * ]
      */
     public function __construct(array config)
@@ -110,14 +114,10 @@ class QueryBuilder extends AbstractAdapter
     public function paginate() -> <RepositoryInterface>
     {
         var originalBuilder, builder, totalBuilder, totalPages, limit,
-            number, query, previous, items, totalQuery, result, row, rowcount,
-            next, sql, columns, db, model, modelClass, dbService, groups,
-            groupColumn;
-        bool hasHaving, hasGroup;
+            number, query, previous, items, rowcount, next, countSource;
         int numberPage;
 
         let originalBuilder = this->builder;
-        let columns = this->columns;
 
         /**
          * We make a copy of the original builder to leave it as it is
@@ -160,6 +160,75 @@ class QueryBuilder extends AbstractAdapter
          */
         let items = query->execute();
 
+        /**
+         * The total is read from the count cache, estimated by the database
+         * planner with the `countEstimate` option, or counted
+         */
+        let rowcount    = null,
+            countSource = null;
+
+        if isset this->config["countCache"] {
+            let countSource = originalBuilder->getPhql() . serialize(originalBuilder->getBindParams()),
+                rowcount    = this->getCachedCount(countSource);
+        }
+
+        if rowcount === null {
+            if isset this->config["countEstimate"] && this->config["countEstimate"] {
+                let rowcount = this->estimateRows(originalBuilder);
+            }
+
+            if rowcount === null {
+                let rowcount = this->countRows(totalBuilder);
+            }
+
+            if countSource !== null {
+                this->setCachedCount(countSource, rowcount);
+            }
+        }
+
+        let totalPages = intval(ceil(rowcount / limit));
+
+        if numberPage < totalPages {
+            let next = numberPage + 1;
+        } else {
+            let next = totalPages;
+        }
+
+        return this->getRepository(
+            [
+                RepositoryInterface::PROPERTY_ITEMS         : items,
+                RepositoryInterface::PROPERTY_TOTAL_ITEMS   : rowcount,
+                RepositoryInterface::PROPERTY_LIMIT         : this->limitRows,
+                RepositoryInterface::PROPERTY_FIRST_PAGE    : 1,
+                RepositoryInterface::PROPERTY_PREVIOUS_PAGE : previous,
+                RepositoryInterface::PROPERTY_CURRENT_PAGE  : numberPage,
+                RepositoryInterface::PROPERTY_NEXT_PAGE     : next,
+                RepositoryInterface::PROPERTY_LAST_PAGE     : totalPages
+            ]
+        );
+    }
+
+    /**
+     * Set query builder object
+     */
+    public function setQueryBuilder(<Builder> builder) -> <QueryBuilder>
+    {
+        let this->builder = builder;
+
+        return this;
+    }
+
+    /**
+     * Counts the rows of the builder, changing its columns to a `COUNT(*)`
+     */
+    protected function countRows(<Builder> totalBuilder) -> int
+    {
+        var totalQuery, result, row, rowcount, sql, columns, db, groups,
+            groupColumn;
+        bool hasHaving, hasGroup;
+
+        let columns = this->columns;
+
         let hasHaving = !empty totalBuilder->getHaving();
 
         let groups = totalBuilder->getGroupBy();
@@ -223,19 +292,7 @@ class QueryBuilder extends AbstractAdapter
          */
         if hasHaving {
             let sql = totalQuery->getSql(),
-                modelClass = builder->getModels();
-
-            if unlikely modelClass === null {
-                throw new Exception("Model not defined in builder");
-            }
-
-            if typeof modelClass == "array" {
-                let modelClass = array_values(modelClass)[0];
-            }
-
-            let model     = create_instance(modelClass),
-                dbService = model->getReadConnectionService(),
-                db        = totalBuilder->getDI()->get(dbService);
+                db  = this->getReadConnection(totalBuilder);
 
             let row = db->fetchOne(
                 "SELECT COUNT(*) as \"rowcount\" FROM (" .  sql["sql"] . ") as T1",
@@ -243,42 +300,96 @@ class QueryBuilder extends AbstractAdapter
                 sql["bind"]
             );
 
-            let rowcount = row ? intval(row["rowcount"]) : 0,
-                totalPages = intval(ceil(rowcount / limit));
+            let rowcount = row ? intval(row["rowcount"]) : 0;
         } else {
             let result = totalQuery->execute(),
                 row = result->getFirst(),
-                rowcount = row ? intval(row->rowcount) : 0,
-                totalPages = intval(ceil(rowcount / limit));
+                rowcount = row ? intval(row->rowcount) : 0;
         }
 
-        if numberPage < totalPages {
-            let next = numberPage + 1;
-        } else {
-            let next = totalPages;
+        return rowcount;
+    }
+
+    /**
+     * Returns the number of rows estimated by the database planner, read
+     * from `EXPLAIN` on MySQL and PostgreSQL, or null for other databases
+     * and for grouped queries, which are counted. The MySQL estimate is the
+     * one of the first table of the plan, so it is unreliable with joins
+     */
+    protected function estimateRows(<Builder> builder) -> int | null
+    {
+        var db, estimateBuilder, plan, row, sql;
+
+        /**
+         * The planner estimates the rows read, not the groups returned
+         */
+        if !empty builder->getGroupBy() || !empty builder->getHaving() {
+            return null;
         }
 
-        return this->getRepository(
-            [
-                RepositoryInterface::PROPERTY_ITEMS         : items,
-                RepositoryInterface::PROPERTY_TOTAL_ITEMS   : rowcount,
-                RepositoryInterface::PROPERTY_LIMIT         : this->limitRows,
-                RepositoryInterface::PROPERTY_FIRST_PAGE    : 1,
-                RepositoryInterface::PROPERTY_PREVIOUS_PAGE : previous,
-                RepositoryInterface::PROPERTY_CURRENT_PAGE  : numberPage,
-                RepositoryInterface::PROPERTY_NEXT_PAGE     : next,
-                RepositoryInterface::PROPERTY_LAST_PAGE     : totalPages
-            ]
-        );
+        let estimateBuilder = clone builder;
+
+        estimateBuilder->orderBy(null);
+
+        let sql = estimateBuilder->getQuery()->getSql(),
+            db  = this->getReadConnection(estimateBuilder);
+
+        switch db->getType() {
+            case "mysql":
+                let row = db->fetchOne(
+                    "EXPLAIN " . sql["sql"],
+                    Enum::FETCH_ASSOC,
+                    sql["bind"]
+                );
+
+                if isset row["rows"] {
+                    return intval(row["rows"]);
+                }
+
+                break;
+
+            case "pgsql":
+                let row = db->fetchOne(
+                    "EXPLAIN (FORMAT JSON) " . sql["sql"],
+                    Enum::FETCH_NUM,
+                    sql["bind"]
+                );
+
+                if isset row[0] {
+                    let plan = json_decode(row[0], true);
+
+                    if isset plan[0]["Plan"]["Plan Rows"] {
+                        return intval(plan[0]["Plan"]["Plan Rows"]);
+                    }
+                }
+
+                break;
+        }
+
+        return null;
     }
 
     /**
-     * Set query builder object
+     * Returns the read connection of the first model of the builder
      */
-    public function setQueryBuilder(<Builder> builder) -> <QueryBuilder>
+    private function getReadConnection(<Builder> builder) -> var
     {
-        let this->builder = builder;
+        var model, modelClass;
 
-        return this;
+        let modelClass = builder->getModels();
+
+        if unlikely modelClass === null {
+            throw new Exception("Model not defined in builder");
+        }
+
+        if typeof modelClass == "array" {
+            let modelClass = array_values(modelClass)[0];
+        }
+
+        let model = create_instance(modelClass);
+
+        return builder->getDI()->get(
+            model->getReadConnectionService()
+        );
     }
 }
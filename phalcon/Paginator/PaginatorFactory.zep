@@ -101,6 +101,7 @@ class PaginatorFactory extends AbstractFactory
     protected function getServices() -> array
     {
         return [
+            "keyset"       : "Phalcon\\Paginator\\Adapter\\Keyset",
             "model"        : "Phalcon\\Paginator\\Adapter\\Model",
             "nativeArray"  : "Phalcon\\Paginator\\Adapter\\NativeArray",
             "queryBuilder" : "Phalcon\\Paginator\\Adapter\\QueryBuilder"
@@ -19,6 +19,9 @@ use JsonSerializable;
  */
 class Repository implements RepositoryInterface, JsonSerializable
 {
+    const PROPERTY_NEXT_CURSOR     = "next_cursor";
+    const PROPERTY_PREVIOUS_CURSOR = "previous_cursor";
+
     /**
      * @var array
      */
@@ -110,6 +113,14 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_NEXT_PAGE, 0);
     }
 
+    /**
+     * Gets the cursor of the next page, returned by the keyset adapter
+     */
+    public function getNextCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_NEXT_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
@@ -118,6 +129,14 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_PREVIOUS_PAGE, 0);
     }
 
+    /**
+     * Gets the cursor of the previous page, returned by the keyset adapter
+     */
+    public function getPreviousCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_PREVIOUS_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
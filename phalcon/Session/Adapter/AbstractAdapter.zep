@@ -10,9 +10,18 @@
 
 namespace Phalcon\Session\Adapter;
 
+use Phalcon\Session\Exception;
 use Phalcon\Storage\Adapter\AdapterInterface;
 use SessionHandlerInterface;
 
+/**
+ * Base class of the storage based session adapters. With the `lazyWrite`
+ * option, a session whose data did not change since it was read only has its
+ * expiration refreshed. With the `locking` option, a session is locked from
+ * read() to close(), so concurrent requests of the same session wait for each
+ * other instead of overwriting their data. The lock expires after `lockTtl`
+ * seconds and read() gives up after waiting `lockWait` seconds
+ */
 abstract class AbstractAdapter implements SessionHandlerInterface
 {
     /**
@@ -20,11 +29,55 @@ abstract class AbstractAdapter implements SessionHandlerInterface
      */
     protected adapter;
 
+    /**
+     * Hashes of the data read, per session id
+     *
+     * @var array
+     */
+    protected hashes = [];
+
+    /**
+     * @var bool
+     */
+    protected lazyWrite = false;
+
+    /**
+     * @var bool
+     */
+    protected locking = false;
+
+    /**
+     * Tokens of the locks held, per session id
+     *
+     * @var array
+     */
+    protected locks = [];
+
+    /**
+     * @var int
+     */
+    protected lockTtl = 30;
+
+    /**
+     * @var int
+     */
+    protected lockWait = 10;
+
     /**
      * Close
      */
     public function close() -> bool
     {
+        var id, locks;
+
+        let locks = this->locks;
+
+        for id, _ in locks {
+            this->releaseLock(id);
+        }
+
+        let this->hashes = [];
+
         return true;
     }
 
@@ -33,11 +86,19 @@ abstract class AbstractAdapter implements SessionHandlerInterface
      */
     public function destroy(var id) -> bool
     {
+        var result;
+
+        let result = true;
+
         if !empty(id) && this->adapter->has(id) {
-            return this->adapter->delete(id);
+            let result = this->adapter->delete(id);
         }
 
-        return true;
+        unset this->hashes[id];
+
+        this->releaseLock(id);
+
+        return result;
     }
 
     /**
@@ -57,9 +118,22 @@ abstract class AbstractAdapter implements SessionHandlerInterface
     public function read(var id) -> string
     {
         var data;
+
+        if this->locking {
+            this->acquireLock(id);
+        }
+
         let data = this->adapter->get(id);
 
-        return null === data ? "" : data;
+        if null === data {
+            let data = "";
+        }
+
+        if this->lazyWrite {
+            let this->hashes[id] = md5(data);
+        }
+
+        return data;
     }
 
     /**
@@ -75,7 +149,80 @@ abstract class AbstractAdapter implements SessionHandlerInterface
      */
     public function write(var id, var data) -> bool
     {
-        return this->adapter->set(id, data);
+        var hash, previous;
+
+        if !this->lazyWrite {
+            return this->adapter->set(id, data);
+        }
+
+        let hash = md5(data);
+
+        /**
+         * Only refresh the expiration of unchanged data
+         */
+        if fetch previous, this->hashes[id] {
+            if previous === hash {
+                return this->touch(id, data);
+            }
+        }
+
+        if !this->adapter->set(id, data) {
+            return false;
+        }
+
+        let this->hashes[id] = hash;
+
+        return true;
+    }
+
+    /**
+     * Waits for the lock of a session, backing off between attempts
+     *
+     * @throws Exception
+     */
+    protected function acquireLock(var id) -> void
+    {
+        var token;
+        int delay, waited;
+
+        if isset this->locks[id] {
+            return;
+        }
+
+        let token  = uniqid("", true),
+            delay  = 1000,
+            waited = 0;
+
+        while !this->addLock(this->getLockKey(id), token) {
+            if unlikely waited >= this->lockWait * 1000000 {
+                throw new Exception(
+                    "The session [" . id . "] could not be locked"
+                );
+            }
+
+            usleep(delay);
+
+            let waited += delay;
+
+            if delay < 100000 {
+                let delay = delay * 2;
+            }
+        }
+
+        let this->locks[id] = token;
+    }
+
+    /**
+     * Stores the lock token unless the lock exists. Adapters override this
+     * with an atomic operation of their backend
+     */
+    protected function addLock(string! key, string! token) -> bool
+    {
+        if this->adapter->has(key) {
+            return false;
+        }
+
+        return this->adapter->set(key, token, this->lockTtl);
     }
 
     /**
@@ -94,4 +241,59 @@ abstract class AbstractAdapter implements SessionHandlerInterface
 
         return value;
     }
+
+    /**
+     * Returns the key of the lock of a session
+     */
+    protected function getLockKey(var id) -> string
+    {
+        return (string) id . ".lock";
+    }
+
+    /**
+     * Releases the lock of a session held by this adapter
+     */
+    protected function releaseLock(var id) -> void
+    {
+        var token;
+
+        if !fetch token, this->locks[id] {
+            return;
+        }
+
+        unset this->locks[id];
+
+        this->removeLock(this->getLockKey(id), token);
+    }
+
+    /**
+     * Removes the lock if it still holds the token. Adapters override this
+     * with the operations of their backend
+     */
+    protected function removeLock(string! key, string! token) -> void
+    {
+        if this->adapter->get(key) === token {
+            this->adapter->delete(key);
+        }
+    }
+
+    /**
+     * Reads the `lazyWrite`, `locking`, `lockTtl` and `lockWait` options
+     */
+    protected function setSessionOptions(array! options) -> void
+    {
+        let this->lazyWrite = (bool) this->getArrVal(options, "lazyWrite", false),
+            this->locking   = (bool) this->getArrVal(options, "locking", false),
+            this->lockTtl   = (int) this->getArrVal(options, "lockTtl", 30),
+            this->lockWait  = (int) this->getArrVal(options, "lockWait", 10);
+    }
+
+    /**
+     * Refreshes the expiration of unchanged data. Adapters override this to
+     * avoid sending the data again
+     */
+    protected function touch(var id, var data) -> bool
+    {
+        return this->adapter->set(id, data);
+    }
 }
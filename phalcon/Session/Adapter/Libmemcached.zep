@@ -33,12 +33,61 @@ class Libmemcached extends AbstractAdapter
      *     'defaultSerializer' => 'Php',
      *     'lifetime' => 3600,
      *     'serializer' => null,
-     *     'prefix' => 'sess-memc-'
+     *     'prefix' => 'sess-memc-',
+     *     'lazyWrite' => false,
+     *     'locking' => false,
+     *     'lockTtl' => 30,
+     *     'lockWait' => 10
      * ]
      */
     public function __construct(<AdapterFactory> factory, array! options = [])
     {
         let options["prefix"] = this->getArrVal(options, "prefix", "sess-memc-"),
             this->adapter     = factory->newInstance("libmemcached", options);
+
+        this->setSessionOptions(options);
+    }
+
+    /**
+     * Stores the lock token with add(), expiring after the lock TTL
+     */
+    protected function addLock(string! key, string! token) -> bool
+    {
+        return this->adapter->getAdapter()->add(key, token, this->lockTtl);
+    }
+
+    /**
+     * Removes the lock if it still holds the token. The lock is replaced
+     * with cas() first, which fails if another request acquired it after it
+     * expired, and only then deleted. Other requests only acquire the lock
+     * with add(), which fails while the replaced lock exists
+     */
+    protected function removeLock(string! key, string! token) -> void
+    {
+        var connection, lock;
+
+        let connection = this->adapter->getAdapter(),
+            lock       = connection->get(key, null, \Memcached::GET_EXTENDED);
+
+        if typeof lock !== "array" || lock["value"] !== token {
+            return;
+        }
+
+        if connection->cas(lock["cas"], key, "", this->lockTtl) {
+            connection->delete(key);
+        }
+    }
+
+    /**
+     * Refreshes the expiration of unchanged data without sending it, unless
+     * the data expired in the meantime
+     */
+    protected function touch(var id, var data) -> bool
+    {
+        if this->adapter->getAdapter()->touch(id, this->adapter->getLifetime()) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
     }
 }
@@ -29,11 +29,57 @@ use Phalcon\Storage\AdapterFactory;
      *                                'persistent' => false,
      *                                'auth'       => '',
      *                                'socket'     => '',
+     *                                'lazyWrite'  => false,
+     *                                'locking'    => false,
+     *                                'lockTtl'    => 30,
+     *                                'lockWait'   => 10,
      * ]
      */
     public function __construct(<AdapterFactory> factory, array! options = [])
     {
         let options["prefix"] = this->getArrVal(options, "prefix", "sess-reds-"),
             this->adapter     = factory->newInstance("redis", options);
+
+        this->setSessionOptions(options);
+    }
+
+    /**
+     * Stores the lock token with SET NX, expiring after the lock TTL
+     */
+    protected function addLock(string! key, string! token) -> bool
+    {
+        var options;
+
+        let options   = ["ex" : this->lockTtl],
+            options[] = "nx";
+
+        return true === this->adapter->getAdapter()->set(key, token, options);
+    }
+
+    /**
+     * Removes the lock if it still holds the token. The comparison and the
+     * deletion run atomically in a Lua script, so a lock that expired and
+     * was acquired by another request in the meantime is kept
+     */
+    protected function removeLock(string! key, string! token) -> void
+    {
+        this->adapter->getAdapter()->eval(
+            "if redis.call('get', KEYS[1]) == ARGV[1] then return redis.call('del', KEYS[1]) end return 0",
+            [key, token],
+            1
+        );
+    }
+
+    /**
+     * Refreshes the expiration of unchanged data without sending it, unless
+     * the data expired in the meantime
+     */
+    protected function touch(var id, var data) -> bool
+    {
+        if this->adapter->getAdapter()->expire(id, this->adapter->getLifetime()) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
     }
 }
@@ -15,7 +15,13 @@ use Phalcon\Session\Exception;
 /**
  * Phalcon\Session\Adapter\Stream
  *
- * This is the file based adapter. It stores sessions in a file based system
+ * This is the file based adapter. It stores sessions in a file based system.
+ * With the `lazyWrite` option, a session whose data did not change since it
+ * was read only has the modification time of its file refreshed. With the
+ * `locking` option, the file of a session is locked with flock() from read()
+ * to close(), so concurrent requests of the same session wait for each other.
+ * Sessions without a file are not locked, so no file is created for them
+ * until they are written
  *
  * ```php
  * <?php
@@ -38,6 +44,30 @@ use Phalcon\Session\Exception;
  */
 class Stream extends Noop
 {
+    /**
+     * Handles of the locked files, per session id
+     *
+     * @var array
+     */
+    private handles = [];
+
+    /**
+     * Hashes of the data read, per session id
+     *
+     * @var array
+     */
+    private hashes = [];
+
+    /**
+     * @var bool
+     */
+    private lazyWrite = false;
+
+    /**
+     * @var bool
+     */
+    private locking = false;
+
     /**
      * @var string
      */
@@ -48,7 +78,9 @@ class Stream extends Noop
      *
      * @param array $options = [
      *     'prefix' => '',
-     *     'savePath' => ''
+     *     'savePath' => '',
+     *     'lazyWrite' => false,
+     *     'locking' => false
      * ]
      */
     public function __construct(array! options = [])
@@ -71,7 +103,27 @@ class Stream extends Noop
             throw new Exception("The session save path [" . path . "] is not writable");
         }
 
-        let this->path = this->getDirSeparator(path);
+        let this->path      = this->getDirSeparator(path),
+            this->lazyWrite = (bool) this->getArrVal(options, "lazyWrite", false),
+            this->locking   = (bool) this->getArrVal(options, "locking", false);
+    }
+
+    /**
+     * Releases the locks held and forgets the data read
+     */
+    public function close() -> bool
+    {
+        var handles, id;
+
+        let handles = this->handles;
+
+        for id, _ in handles {
+            this->unlock(id);
+        }
+
+        let this->hashes = [];
+
+        return true;
     }
 
     public function destroy(var id) -> bool
@@ -80,6 +132,10 @@ class Stream extends Noop
 
         let file = this->path . this->getPrefixedName(id);
 
+        unset this->hashes[id];
+
+        this->unlock(id);
+
         if file_exists(file) && is_file(file) {
             unlink(file);
         }
@@ -144,7 +200,9 @@ class Stream extends Noop
         let name = this->path . this->getPrefixedName(id),
             data = "";
 
-        if true === this->phpFileExists(name) {
+        if this->locking {
+            let data = this->readLocked(id, name);
+        } elseif true === this->phpFileExists(name) {
             let pointer = this->phpFopen(name, "r");
 
             if (flock(pointer, LOCK_SH)) {
@@ -154,20 +212,53 @@ class Stream extends Noop
             fclose(pointer);
 
             if false === data {
-                return "";
+                let data = "";
             }
         }
 
+        if this->lazyWrite {
+            let this->hashes[id] = md5(data);
+        }
+
         return data;
     }
 
     public function write(var id, var data) -> bool
     {
-        var name;
+        var hash, name, pointer, previous;
+
+        let name = this->path . this->getPrefixedName(id),
+            hash = null;
+
+        if this->lazyWrite {
+            let hash = md5(data);
+
+            /**
+             * Only refresh the modification time of unchanged data
+             */
+            if fetch previous, this->hashes[id] {
+                if previous === hash && true === this->phpFileExists(name) {
+                    return touch(name);
+                }
+            }
+        }
 
-        let name = this->path . this->getPrefixedName(id);
+        if fetch pointer, this->handles[id] {
+            ftruncate(pointer, 0);
+            rewind(pointer);
 
-        return false !== this->phpFilePutContents(name, data, LOCK_EX);
+            if false === fwrite(pointer, data) || !fflush(pointer) {
+                return false;
+            }
+        } elseif false === this->phpFilePutContents(name, data, LOCK_EX) {
+            return false;
+        }
+
+        if hash !== null {
+            let this->hashes[id] = hash;
+        }
+
+        return true;
     }
 
     /**
@@ -197,6 +288,65 @@ class Stream extends Noop
         return rtrim(directory, DIRECTORY_SEPARATOR) . DIRECTORY_SEPARATOR;
     }
 
+    /**
+     * Locks the file of a session, waiting for other requests to release
+     * it, and reads it. The file is opened without being created, so
+     * visitors without a session do not leave empty files behind
+     */
+    private function readLocked(var id, string! name) -> string
+    {
+        var data, pointer;
+
+        if !fetch pointer, this->handles[id] {
+            if true !== this->phpFileExists(name) {
+                return "";
+            }
+
+            let pointer = this->phpFopen(name, "r+");
+
+            if unlikely false === pointer || !flock(pointer, LOCK_EX) {
+                throw new Exception(
+                    "The session [" . id . "] could not be locked"
+                );
+            }
+
+            /**
+             * The session may have been destroyed while waiting for the lock
+             */
+            clearstatcache(true, name);
+
+            if true !== this->phpFileExists(name) {
+                flock(pointer, LOCK_UN);
+                fclose(pointer);
+
+                return "";
+            }
+
+            let this->handles[id] = pointer;
+        }
+
+        rewind(pointer);
+
+        let data = stream_get_contents(pointer);
+
+        return false === data ? "" : data;
+    }
+
+    /**
+     * Releases the lock of a session and closes its file
+     */
+    private function unlock(var id) -> void
+    {
+        var pointer;
+
+        if fetch pointer, this->handles[id] {
+            unset this->handles[id];
+
+            flock(pointer, LOCK_UN);
+            fclose(pointer);
+        }
+    }
+
 
     /**
      * Gets the glob array or returns false on failure
@@ -23,11 +23,28 @@ use RecursiveIteratorIterator;
 /**
  * Stream adapter
  *
+ * Every item is stored in its own file, in subdirectories named after the
+ * key. The file starts with a 16 bytes header holding a signature, the
+ * expiration timestamp (0 for items stored forever) and the length of the
+ * data, so expired items are
+ * detected without reading or unserializing the data. Files are written to a
+ * temporary file and renamed into place, so they are read without locks.
+ *
+ * With the `index` option, the keys are also logged in an index file of the
+ * prefix directory, which getKeys() and clear() read instead of walking the
+ * directories. Only the items stored through the index are listed and
+ * cleared
+ *
  * @property string $storageDir
  * @property array  $options
  */
 class Stream extends AbstractAdapter
 {
+    /**
+     * @var bool
+     */
+    protected index = false;
+
     /**
      * @var string
      */
@@ -46,7 +63,8 @@ class Stream extends AbstractAdapter
      *     'storageDir'        => '',
      *     'defaultSerializer' => 'php',
      *     'lifetime'          => 3600,
-     *     'prefix'            => ''
+     *     'prefix'            => '',
+     *     'index'             => false
      * ]
      *
      * @throws Exception
@@ -63,7 +81,8 @@ class Stream extends AbstractAdapter
         /**
          * Lets set some defaults and options here
          */
-        let this->storageDir = this->getDirSeparator(storageDir);
+        let this->storageDir = this->getDirSeparator(storageDir),
+            this->index      = (bool) this->getArrVal(options, "index", false);
 
         parent::__construct(factory, options);
 
@@ -78,8 +97,13 @@ class Stream extends AbstractAdapter
         var directory, iterator, file;
         bool result;
 
-        let result    = true,
-            directory = this->getDirSeparator(this->storageDir),
+        let result = true;
+
+        if this->index {
+            return this->clearIndex();
+        }
+
+        let directory = this->getDirSeparator(this->storageDir),
             iterator  = this->getIterator(directory);
 
         for file in iterator {
@@ -147,6 +171,10 @@ class Stream extends AbstractAdapter
 
         let result = unlink(filepath);
 
+        if result && this->index {
+            this->appendIndex("-", this->getKeyWithoutPrefix(key));
+        }
+
         this->fire(this->eventType . ":afterDelete", key);
 
         return result;
@@ -180,7 +208,7 @@ class Stream extends AbstractAdapter
             return defaultValue;
         }
 
-        let content = this->getArrVal(payload, "content");
+        let content = payload["content"];
 
         let result = this->getUnserializedData(content, defaultValue);
 
@@ -198,12 +226,22 @@ class Stream extends AbstractAdapter
      */
     public function getKeys(string! prefix = "") -> array
     {
-        var directory, file, iterator;
+        var directory, file, iterator, key, keys;
         array files;
 
         let files     = [],
             directory = this->getDir();
 
+        if this->index {
+            let keys = this->getIndexedKeys();
+
+            for key in keys {
+                let files[] = this->prefix . key;
+            }
+
+            return this->getFilteredKeys(files, prefix);
+        }
+
         if unlikely true !== this->phpFileExists(directory) {
             return [];
         }
@@ -211,9 +249,18 @@ class Stream extends AbstractAdapter
         let iterator  = this->getIterator(directory);
 
         for file in iterator {
-            if true === file->isFile() {
-                let files[] = this->prefix . file->getFilename();
+            if true !== file->isFile() {
+                continue;
             }
+
+            /**
+             * The index and the files set() is still writing are not keys
+             */
+            if ".index" === file->getFilename() || preg_match("/\\.[0-9a-f]{14}\\.[0-9]{8}\\.tmp$/", file->getFilename()) {
+                continue;
+            }
+
+            let files[] = this->prefix . file->getFilename();
         }
 
         return this->getFilteredKeys(files, prefix);
@@ -228,7 +275,7 @@ class Stream extends AbstractAdapter
      */
     public function has(string! key) -> bool
     {
-        var payload, filepath, result;
+        var header, filepath, result;
 
         this->fire(this->eventType . ":beforeHas", key);
 
@@ -240,15 +287,15 @@ class Stream extends AbstractAdapter
             return false;
         }
 
-        let payload = this->getPayload(filepath);
+        let header = this->getHeader(filepath);
 
-        if unlikely empty payload {
+        if unlikely empty header {
             this->fire(this->eventType . ":afterHas", key);
 
             return false;
         }
 
-        let result = !this->isExpired(payload);
+        let result = !this->isExpired(header);
 
         this->fire(this->eventType . ":afterHas", key);
 
@@ -303,7 +350,6 @@ class Stream extends AbstractAdapter
      */
     public function set(string! key, var value, var ttl = null) -> bool
     {
-        array payload;
         var result;
 
         this->fire(this->eventType . ":beforeSet", key);
@@ -316,13 +362,11 @@ class Stream extends AbstractAdapter
             return result;
         }
 
-        let payload   = [
-            "created" : time(),
-            "ttl"     : this->getTtl(ttl),
-            "content" : this->getSerializedData(value)
-        ];
-
-        let result = this->storePayload(payload, key);
+        let result = this->storePayload(
+            key,
+            this->getSerializedData(value),
+            time() + this->getTtl(ttl)
+        );
 
         this->fire(this->eventType . ":afterSet", key);
 
@@ -340,15 +384,106 @@ class Stream extends AbstractAdapter
      */
     public function setForever(string! key, var value) -> bool
     {
-        array payload;
+        return this->storePayload(key, this->getSerializedData(value), 0);
+    }
 
-        let payload   = [
-            "created" : time(),
-            "ttl"     : "forever",
-            "content" : this->getSerializedData(value)
-        ];
+    /**
+     * Logs an added or a removed key in the index file
+     *
+     * @param string $operation
+     * @param string $key
+     */
+    private function appendIndex(string! operation, string! key) -> void
+    {
+        this->phpFilePutContents(
+            this->getIndexFile(),
+            operation . addcslashes(key, "\\\n") . "\n",
+            FILE_APPEND | LOCK_EX
+        );
+    }
+
+    /**
+     * Deletes the items logged in the index file and empties it, holding an
+     * exclusive lock on the index from the read to the truncation so no key
+     * is appended meanwhile
+     *
+     * @return bool
+     */
+    private function clearIndex() -> bool
+    {
+        var filepath, indexFile, key, keys, pointer;
+        bool result;
+
+        let indexFile = this->getIndexFile();
 
-        return this->storePayload(payload, key);
+        /**
+         * There is no index yet
+         */
+        if true !== this->phpFileExists(indexFile) {
+            return true;
+        }
+
+        let pointer = this->phpFopen(indexFile, "r+");
+
+        if unlikely false === pointer {
+            return false;
+        }
+
+        if unlikely !flock(pointer, LOCK_EX) {
+            fclose(pointer);
+
+            return false;
+        }
+
+        let result = true,
+            keys   = this->parseIndex(stream_get_contents(pointer));
+
+        for key in keys {
+            let filepath = this->getFilepath(key);
+
+            if this->phpFileExists(filepath) && true !== this->phpUnlink(filepath) {
+                let result = false;
+            }
+        }
+
+        ftruncate(pointer, 0);
+        fflush(pointer);
+        flock(pointer, LOCK_UN);
+        fclose(pointer);
+
+        return result;
+    }
+
+    /**
+     * Compacts the index file, under an exclusive lock so no key is appended
+     * meanwhile
+     */
+    private function compactIndex() -> void
+    {
+        var content, key, keys, pointer;
+
+        let pointer = this->phpFopen(this->getIndexFile(), "c+");
+
+        if unlikely false === pointer {
+            return;
+        }
+
+        if flock(pointer, LOCK_EX) {
+            let content = "",
+                keys    = this->parseIndex(stream_get_contents(pointer));
+
+            for key in keys {
+                let content .= "+" . addcslashes(key, "\\\n") . "\n";
+            }
+
+            ftruncate(pointer, 0);
+            rewind(pointer);
+            fwrite(pointer, content);
+            fflush(pointer);
+            flock(pointer, LOCK_UN);
+        }
+
+        fclose(pointer);
     }
 
     /**
@@ -416,19 +551,19 @@ class Stream extends AbstractAdapter
     }
 
     /**
-     * Gets the file contents and returns an array or an error if something
-     * went wrong
+     * Reads the header of a file and returns its expiration and the length
+     * of its data, or an empty array if the file is not valid or its size
+     * does not match the length of the data
      *
      * @param string $filepath
      *
      * @return array
      */
-    private function getPayload(string filepath) -> array
+    private function getHeader(string filepath) -> array
     {
-        var payload, pointer, version;
+        var header, pointer, stat;
 
-        let payload = false,
-            pointer = this->phpFopen(filepath, "r");
+        let pointer = this->phpFopen(filepath, "rb");
 
         /**
          * Cannot open file
@@ -437,93 +572,239 @@ class Stream extends AbstractAdapter
             return [];
         }
 
-        if likely true === flock(pointer, LOCK_SH) {
-            let payload = this->phpFileGetContents(filepath);
-        }
+        /**
+         * The size and the header come from the same file, even when set()
+         * renames a new one in place meanwhile
+         */
+        let stat   = fstat(pointer),
+            header = this->parseHeader(
+                this->phpFread(pointer, 16)
+            );
 
         fclose(pointer);
 
         /**
-         * No results
+         * A truncated file holds less data than its header announces
          */
-        if unlikely false === payload {
+        if unlikely empty header || typeof stat !== "array" || header["length"] !== stat["size"] - 16 {
             return [];
         }
 
-        let version = phpversion();
-        globals_set("warning.enable", false);
+        return header;
+    }
 
-        if version_compare(version, "8.0", ">=") {
-            set_error_handler(
-                function (number, message, file, line) {
-                    globals_set("warning.enable", true);
-                },
-                E_NOTICE
-            );
-        } else {
-            set_error_handler(
-                function (number, message, file, line, context) {
-                    globals_set("warning.enable", true);
-                },
-                E_NOTICE
-            );
+    /**
+     * Returns the keys logged in the index file. The file is compacted when
+     * most of its lines are removed keys
+     *
+     * @return array
+     */
+    private function getIndexedKeys() -> array
+    {
+        var content, indexFile, keys;
+
+        let indexFile = this->getIndexFile();
+
+        if true !== this->phpFileExists(indexFile) {
+            return [];
+        }
+
+        let content = this->phpFileGetContents(indexFile);
+
+        if unlikely typeof content !== "string" {
+            return [];
         }
 
-        let payload = unserialize(payload);
+        let keys = this->parseIndex(content);
+
+        if substr_count(content, "\n") > 2 * count(keys) + 100 {
+            this->compactIndex();
+        }
+
+        return keys;
+    }
+
+    /**
+     * Returns the path of the index file of the prefix
+     *
+     * @return string
+     */
+    private function getIndexFile() -> string
+    {
+        return this->getDirSeparator(this->storageDir . this->prefix) . ".index";
+    }
+
+    /**
+     * Gets the file contents and returns the header and the data, or an
+     * empty array if the file is not valid
+     *
+     * @param string $filepath
+     *
+     * @return array
+     */
+    private function getPayload(string filepath) -> array
+    {
+        var content, header;
 
-        restore_error_handler();
+        let content = this->phpFileGetContents(filepath),
+            header  = this->parseHeader(content);
 
-        if unlikely (globals_get("warning.enable") || typeof payload !== "array") {
+        /**
+         * No results or an unknown format
+         */
+        if unlikely empty header || header["length"] !== strlen(content) - 16 {
             return [];
         }
 
-        return payload;
+        let content = substr(content, 16);
+
+        /**
+         * Data left as is by the serializer
+         */
+        if header["serialized"] {
+            let content = unserialize(content);
+        }
+
+        let header["content"] = content;
+
+        return header;
     }
 
     /**
      * Returns if the cache has expired for this item or not
      *
-     * @param array $payload
+     * @param array $header
      *
      * @return bool
      */
-    private function isExpired(array! payload) -> bool
+    private function isExpired(array! header) -> bool
     {
-        var created, ttl;
+        var expires;
 
-        let created = this->getArrVal(payload, "created", time()),
-            ttl     = this->getArrVal(payload, "ttl", 3600);
+        let expires = header["expires"];
 
-        if ("forever" === ttl) {
+        if 0 === expires {
             return false;
         }
 
-        return (created + ttl) < time();
+        return expires < time();
+    }
+
+    /**
+     * Parses the signature, expiration and length at the start of a file.
+     * The `PHSA` signature marks data that is not a string, serialized by
+     * the adapter
+     *
+     * @param mixed $content
+     *
+     * @return array
+     */
+    private function parseHeader(var content) -> array
+    {
+        var header, signature;
+
+        if unlikely typeof content !== "string" || strlen(content) < 16 {
+            return [];
+        }
+
+        let signature = substr(content, 0, 4);
+
+        if unlikely signature !== "PHST" && signature !== "PHSA" {
+            return [];
+        }
+
+        let header               = unpack("Jexpires/Nlength", content, 4),
+            header["serialized"] = "PHSA" === signature;
+
+        return header;
     }
 
+    /**
+     * Replays the lines of the index file and returns the keys stored
+     *
+     * @param string $content
+     *
+     * @return array
+     */
+    private function parseIndex(string! content) -> array
+    {
+        var key, line, lines;
+        array keys, result;
+
+        let keys   = [],
+            result = [],
+            lines  = explode("\n", content);
+
+        for line in lines {
+            if line === "" {
+                continue;
+            }
+
+            let key = stripcslashes(substr(line, 1));
+
+            if starts_with(line, "+") {
+                let keys[key] = true;
+            } else {
+                unset keys[key];
+            }
+        }
+
+        /**
+         * Numeric keys are converted to integers by the array
+         */
+        for key, _ in keys {
+            let result[] = (string) key;
+        }
+
+        return result;
+    }
 
     /**
-     * Stores an array payload on the file system
+     * Stores the header and the data in a temporary file and renames it
      *
-     * @param array  $payload
      * @param string $key
+     * @param string $content
+     * @param int    $expires
      *
      * @return bool
      */
-    private function storePayload(array payload, string key) -> bool
+    private function storePayload(string key, var content, int expires) -> bool
     {
-        var directory, payload;
+        var directory, exists, filepath, signature, temporary;
 
-        let payload   = serialize(payload),
-            directory = this->getDir(key);
+        let directory = this->getDir(key),
+            filepath  = this->getFilepath(key),
+            temporary = filepath . "." . uniqid("", true) . ".tmp",
+            signature = "PHST";
 
         if !is_dir(directory) {
             mkdir(directory, 0777, true);
         }
 
-        return (
-            false !== this->phpFilePutContents(directory . key, payload, LOCK_EX)
-        );
+        if typeof content !== "string" {
+            let content   = serialize(content),
+                signature = "PHSA";
+        }
+
+        let content = signature . pack("JN", expires, strlen(content)) . content;
+
+        if unlikely false === this->phpFilePutContents(temporary, content) {
+            return false;
+        }
+
+        let exists = this->index && file_exists(filepath);
+
+        if unlikely true !== rename(temporary, filepath) {
+            unlink(temporary);
+
+            return false;
+        }
+
+        if this->index && !exists {
+            this->appendIndex("+", this->getKeyWithoutPrefix(key));
+        }
+
+        return true;
     }
 
     /**
@@ -553,6 +834,11 @@ class Stream extends AbstractAdapter
         return fopen(filename, mode);
     }
 
+    protected function phpFread(var handle, int length) -> string | bool
+    {
+        return fread(handle, length);
+    }
+
     protected function phpUnlink(string filename) -> bool
     {
         return unlink(filename);
@@ -0,0 +1,99 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Support\Helper\File;
+
+/**
+ * Merges entries into a generated PHP file returning an array, such as the
+ * caches shared between requests through opcache. The file is reloaded
+ * while holding an exclusive lock on a sidecar ".lock" file, so the entries
+ * written by other processes are kept, and it is only replaced when the
+ * merge changed its contents. The new contents are written to a temporary
+ * file and renamed, so concurrent requests always include a complete file.
+ */
+class MergeExported
+{
+    /**
+     * The merge callable receives the current contents of the file, an
+     * empty array when it does not exist, and returns the new ones
+     *
+     * @param string   $file
+     * @param callable $merge
+     *
+     * @return array|false The merged contents, false when the file cannot
+     *                     be locked or written
+     */
+    public function __invoke(string file, callable merge) -> array | bool
+    {
+        var contents, current, pointer, result, temporary;
+
+        let pointer = fopen(file . ".lock", "c");
+
+        if unlikely false === pointer {
+            return false;
+        }
+
+        if unlikely !flock(pointer, LOCK_EX) {
+            fclose(pointer);
+
+            return false;
+        }
+
+        try {
+            let current  = this->load(file),
+                contents = call_user_func(merge, current),
+                result   = contents;
+
+            if contents !== current {
+                let temporary = file . "." . uniqid("", true) . ".tmp";
+
+                if false === file_put_contents(temporary, "<?php return " . var_export(contents, true) . ";\n") {
+                    let result = false;
+                } elseif false === rename(temporary, file) {
+                    unlink(temporary);
+
+                    let result = false;
+                } elseif function_exists("opcache_invalidate") {
+                    opcache_invalidate(file, true);
+                }
+            }
+        } catch \Throwable {
+            let result = false;
+        }
+
+        flock(pointer, LOCK_UN);
+        fclose(pointer);
+
+        return result;
+    }
+
+    /**
+     * Returns the array of the file, bypassing the stat cache since another
+     * process may have replaced it
+     */
+    private function load(string file) -> array
+    {
+        var contents;
+
+        clearstatcache(true, file);
+
+        if !file_exists(file) {
+            return [];
+        }
+
+        let contents = require file;
+
+        if typeof contents !== "array" {
+            return [];
+        }
+
+        return contents;
+    }
+}
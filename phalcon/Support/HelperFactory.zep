@@ -53,6 +53,7 @@ use Phalcon\Factory\AbstractFactory;
  * @method mixed  lastKey(array $collection, callable $method = null)
  * @method int    len(string $text, string $encoding = 'UTF-8')
  * @method string lower(string $text, string $encoding = 'UTF-8')
+ * @method array|false mergeExported(string $file, callable $merge)
  * @method array  order(array $collection, $attribute, string $order = 'asc')
  * @method string pascalCase(string $text, string $delimiters = null)
  * @method array  pluck(array $collection, string $element)
@@ -158,6 +159,7 @@ class HelperFactory extends AbstractFactory
             "validateAny"   : "Phalcon\\Support\\Helper\\Arr\\ValidateAny",
             "whitelist"     : "Phalcon\\Support\\Helper\\Arr\\Whitelist",
             "basename"      : "Phalcon\\Support\\Helper\\File\\Basename",
+            "mergeExported" : "Phalcon\\Support\\Helper\\File\\MergeExported",
             "decode"        : "Phalcon\\Support\\Helper\\Json\\Decode",
             "encode"        : "Phalcon\\Support\\Helper\\Json\\Encode",
             "isBetween"     : "Phalcon\\Support\\Helper\\Number\\IsBetween",
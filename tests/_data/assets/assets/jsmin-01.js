@@ -0,0 +1,24 @@
+/**
+ * Sign up form helpers
+ */
+var signup = {
+    // fields validated on submit
+    fields: [ 'name', "email" ],
+    pattern: /^[^@\s]+@[^@\s/]+$/i,
+
+    message: function (field) {
+        return `The field ${ field.toUpperCase() } is not valid`;
+    },
+
+    validate: function (values) {
+        var errors = [], i;
+
+        for (i = 0; i < this.fields.length; i++) {
+            if (!values[this.fields[i]]) {
+                errors.push(this.message(this.fields[i]));
+            }
+        }
+
+        return errors.length === 0 && this.pattern.test(values.email);
+    }
+};
@@ -0,0 +1,54 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Fixtures\Image\Adapter;
+
+use Phalcon\Image\Adapter\AbstractAdapter;
+
+/**
+ * Adapter implementing only processCrop() and processResize(), recording
+ * the calls
+ */
+class CropResizeAdapter extends AbstractAdapter
+{
+    /**
+     * @var array
+     */
+    public array $calls = [];
+
+    public function __construct(int $width, int $height)
+    {
+        $this->file   = '';
+        $this->image  = 'image';
+        $this->width  = $width;
+        $this->height = $height;
+    }
+
+    protected function processCrop(
+        int $width,
+        int $height,
+        int $offsetX,
+        int $offsetY
+    ): void {
+        $this->calls[] = ['crop', $width, $height, $offsetX, $offsetY];
+        $this->width   = $width;
+        $this->height  = $height;
+    }
+
+    protected function processResize(int $width, int $height): void
+    {
+        $this->calls[] = ['resize', $width, $height];
+        $this->width   = $width;
+        $this->height  = $height;
+    }
+}
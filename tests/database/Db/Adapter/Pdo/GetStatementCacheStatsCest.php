@@ -0,0 +1,161 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Db\Adapter\Pdo;
+
+use DatabaseTester;
+use Phalcon\Db\Profiler;
+use Phalcon\Events\Manager;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+
+class GetStatementCacheStatsCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo :: getStatementCacheStats()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  pgsql
+     * @group  mysql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoGetStatementCacheStats(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - getStatementCacheStats()');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->insert(1, 1, 1, 'title 1', 101);
+        $migration->insert(2, 1, 1, 'title 2', 102);
+
+        $db = $this->container->get('db');
+
+        $expected = [
+            'capacity'  => 0,
+            'size'      => 0,
+            'hits'      => 0,
+            'misses'    => 0,
+            'evictions' => 0,
+        ];
+        $I->assertSame($expected, $db->getStatementCacheStats());
+
+        $db->setStatementCacheSize(2);
+
+        $sql = 'SELECT inv_id FROM co_invoices WHERE inv_id = ?';
+
+        $row = $db->fetchOne($sql, \PDO::FETCH_ASSOC, [1]);
+        $I->assertEquals(1, $row['inv_id']);
+
+        $row = $db->fetchOne($sql, \PDO::FETCH_ASSOC, [2]);
+        $I->assertEquals(2, $row['inv_id']);
+
+        $expected = [
+            'capacity'  => 2,
+            'size'      => 1,
+            'hits'      => 1,
+            'misses'    => 1,
+            'evictions' => 0,
+        ];
+        $I->assertSame($expected, $db->getStatementCacheStats());
+
+        /**
+         * A statement used by a live result is not reused
+         */
+        $first  = $db->query($sql, [1]);
+        $second = $db->query($sql, [2]);
+
+        $I->assertEquals(1, $first->fetch()['inv_id']);
+        $I->assertEquals(2, $second->fetch()['inv_id']);
+
+        $stats = $db->getStatementCacheStats();
+        $I->assertSame(2, $stats['hits']);
+        $I->assertSame(2, $stats['misses']);
+
+        unset($first, $second);
+
+        /**
+         * Least recently used statements are evicted
+         */
+        $db->query('SELECT inv_id FROM co_invoices WHERE inv_id = 1');
+        $db->query('SELECT inv_id FROM co_invoices WHERE inv_id = 2');
+
+        $stats = $db->getStatementCacheStats();
+        $I->assertSame(2, $stats['size']);
+        $I->assertSame(1, $stats['evictions']);
+
+        $profiler = new Profiler();
+        $profiler->setStatementCacheStats($stats);
+
+        $I->assertSame(2, $profiler->getStatementCacheHits());
+        $I->assertSame(4, $profiler->getStatementCacheMisses());
+        $I->assertSame(1, $profiler->getStatementCacheEvictions());
+
+        /**
+         * Connecting again removes the cached statements
+         */
+        $db->connect();
+
+        $stats = $db->getStatementCacheStats();
+        $I->assertSame(0, $stats['size']);
+        $I->assertSame(1, $stats['evictions']);
+
+        /**
+         * The size set on the connection is kept when reconnecting
+         */
+        $I->assertSame(2, $db->getStatementCacheSize());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo :: getStatementCacheStats() - profiler
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  pgsql
+     * @group  mysql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoGetStatementCacheStatsProfiler(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - getStatementCacheStats() - profiler');
+
+        $db = $this->container->get('db');
+        $db->setStatementCacheSize(4);
+
+        $profiler      = new Profiler();
+        $eventsManager = new Manager();
+        $eventsManager->attach('db', $profiler);
+        $db->setEventsManager($eventsManager);
+
+        $sql = 'SELECT inv_id FROM co_invoices WHERE inv_id = ?';
+
+        $db->fetchOne($sql, \PDO::FETCH_ASSOC, [1]);
+        $db->fetchOne($sql, \PDO::FETCH_ASSOC, [2]);
+
+        $I->assertSame(2, $profiler->getNumberTotalStatements());
+        $I->assertSame($sql, $profiler->getLastProfile()->getSqlStatement());
+        $I->assertSame(4, $profiler->getStatementCacheCapacity());
+        $I->assertSame(1, $profiler->getStatementCacheSize());
+        $I->assertSame(1, $profiler->getStatementCacheHits());
+        $I->assertSame(1, $profiler->getStatementCacheMisses());
+    }
+}
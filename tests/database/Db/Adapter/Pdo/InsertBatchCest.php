@@ -0,0 +1,162 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Db\Adapter\Pdo;
+
+use DatabaseTester;
+use Phalcon\Db\Column;
+use Phalcon\Db\Exception;
+use Phalcon\Db\RawValue;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+use function array_sum;
+use function ceil;
+use function intdiv;
+
+final class InsertBatchCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\AbstractAdapter :: insertBatch()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  pgsql
+     * @group  mysql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoInsertBatch(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - insertBatch()');
+
+        $connection = $I->getConnection();
+        $db         = $this->container->get('db');
+        $migration  = new InvoicesMigration($connection);
+
+        $rows = [];
+        for ($counter = 1; $counter <= 1000; $counter++) {
+            $rows[] = [
+                1,
+                $counter % 2,
+                'title ' . $counter,
+                $counter,
+                new RawValue('null'),
+            ];
+        }
+
+        $actual = $db->insertBatch(
+            $migration->getTable(),
+            $rows,
+            [
+                'inv_cst_id',
+                'inv_status_flag',
+                'inv_title',
+                'inv_total',
+                'inv_created_at',
+            ],
+            [
+                Column::BIND_PARAM_INT,
+                Column::BIND_PARAM_INT,
+                Column::BIND_PARAM_STR,
+                Column::BIND_PARAM_DECIMAL,
+            ]
+        );
+
+        /**
+         * Four placeholders per row, raw values are not bound
+         */
+        $perChunk = intdiv($db->getDialect()->getMaxPlaceholders(), 4);
+
+        $I->assertCount((int) ceil(1000 / $perChunk), $actual);
+        $I->assertSame(1000, array_sum($actual));
+        $I->assertSame(1000, Invoices::count());
+        $I->assertSame(
+            500,
+            Invoices::count('inv_status_flag = 1')
+        );
+        $I->assertSame(
+            1000,
+            Invoices::count('inv_created_at IS NULL')
+        );
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\AbstractAdapter :: insertBatchAsDict()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  pgsql
+     * @group  mysql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoInsertBatchAsDict(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - insertBatchAsDict()');
+
+        $connection = $I->getConnection();
+        $db         = $this->container->get('db');
+        $migration  = new InvoicesMigration($connection);
+
+        $actual = $db->insertBatchAsDict(
+            $migration->getTable(),
+            [
+                [
+                    'inv_cst_id' => 1,
+                    'inv_title'  => 'title 1',
+                ],
+                [
+                    'inv_title'  => 'title 2',
+                    'inv_cst_id' => 2,
+                ],
+                [
+                    'inv_cst_id' => 3,
+                    'inv_title'  => null,
+                ],
+            ]
+        );
+
+        $I->assertSame([3], $actual);
+        $I->assertSame(3, Invoices::count());
+
+        $invoice = Invoices::findFirst('inv_cst_id = 2');
+        $I->assertSame('title 2', $invoice->inv_title);
+
+        $I->expectThrowable(
+            new Exception(
+                'All the rows inserted into co_invoices must have the same fields'
+            ),
+            function () use ($db, $migration) {
+                $db->insertBatchAsDict(
+                    $migration->getTable(),
+                    [
+                        ['inv_cst_id' => 1],
+                        ['inv_title' => 'title 2'],
+                    ]
+                );
+            }
+        );
+
+        $I->assertSame(3, Invoices::count());
+    }
+}
@@ -0,0 +1,371 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model;
+
+use DatabaseTester;
+use Phalcon\Events\Manager;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Mvc\Model\Resultset\Simple;
+use Phalcon\Tests\Fixtures\Migrations\CustomersMigration;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Customers;
+use Phalcon\Tests\Models\Invoices;
+
+final class FindWithCest
+{
+    use DiTrait;
+
+    /**
+     * @var int
+     */
+    private $queries = 0;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        $connection = $I->getConnection();
+
+        $customersMigration = new CustomersMigration($connection);
+        $customersMigration->insert(1, 1, 'first-1', 'last-1');
+        $customersMigration->insert(2, 1, 'first-2', 'last-2');
+
+        $invoicesMigration = new InvoicesMigration($connection);
+        $invoicesMigration->insert(1, 1, Invoices::STATUS_PAID, 'inv-1');
+        $invoicesMigration->insert(2, 1, Invoices::STATUS_UNPAID, 'inv-2');
+        $invoicesMigration->insert(3, 2, Invoices::STATUS_PAID, 'inv-3');
+        $invoicesMigration->insert(4, 3, Invoices::STATUS_PAID, 'inv-4');
+
+        /**
+         * Load the metadata before counting the queries
+         */
+        Customers::find();
+        Invoices::find();
+
+        $this->queries = 0;
+
+        $manager = new Manager();
+        $manager->attach(
+            'db:beforeQuery',
+            function () {
+                $this->queries++;
+            }
+        );
+
+        $this->container->get('db')->setEventsManager($manager);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() with eager loaded has-one relations
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindWithHasOne(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with has-one');
+
+        $invoices = Invoices::find(
+            [
+                'order' => 'inv_id',
+                'with'  => 'customer',
+            ]
+        );
+
+        $I->assertSame(2, $this->queries);
+
+        $expected = [
+            1 => 1,
+            2 => 1,
+            3 => 2,
+            4 => null,
+        ];
+
+        /**
+         * Iterating twice must not hydrate nor query again
+         */
+        for ($counter = 0; $counter < 2; $counter++) {
+            foreach ($invoices as $invoice) {
+                $I->assertTrue($invoice->isRelationshipLoaded('customer'));
+
+                $customer = $invoice->customer;
+                if (null === $expected[$invoice->inv_id]) {
+                    $I->assertNull($customer);
+                } else {
+                    $I->assertInstanceOf(Customers::class, $customer);
+                    $I->assertEquals(
+                        $expected[$invoice->inv_id],
+                        $customer->cst_id
+                    );
+                }
+            }
+        }
+
+        $I->assertSame(2, $this->queries);
+        $I->assertCount(4, $invoices);
+        $I->assertSame(
+            $invoices[0]->customer,
+            $invoices[1]->customer
+        );
+        $I->assertEquals(
+            'inv-3',
+            $invoices->toArray()[2]['inv_title']
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() with eager loaded nested relations
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindWithNested(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with nested relations');
+
+        $customers = Customers::find(
+            [
+                'order' => 'cst_id',
+                'with'  => [
+                    'invoices.customer',
+                    'paidInvoices',
+                ],
+            ]
+        );
+
+        /**
+         * Customers, invoices, their customers and paid invoices
+         */
+        $I->assertSame(4, $this->queries);
+
+        $expected = [
+            1 => [[1, 2], [1]],
+            2 => [[3], [3]],
+        ];
+
+        foreach ($customers as $customer) {
+            $invoices = $customer->invoices;
+
+            $I->assertInstanceOf(Simple::class, $invoices);
+            $I->assertCount(
+                count($expected[$customer->cst_id][0]),
+                $invoices
+            );
+
+            $actual = [];
+            foreach ($invoices as $invoice) {
+                $actual[] = (int) $invoice->inv_id;
+
+                $I->assertSame($customer->cst_id, $invoice->customer->cst_id);
+            }
+
+            sort($actual);
+            $I->assertSame($expected[$customer->cst_id][0], $actual);
+
+            $actual = [];
+            foreach ($customer->getPaidInvoices() as $invoice) {
+                $actual[] = (int) $invoice->inv_id;
+            }
+
+            $I->assertSame($expected[$customer->cst_id][1], $actual);
+        }
+
+        $I->assertSame(4, $this->queries);
+
+        /**
+         * Related records queried with parameters are not eager loaded
+         */
+        $customers[0]->getInvoices(['inv_id = 1']);
+
+        $I->assertSame(5, $this->queries);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: findFirst() and Criteria :: with()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindFirstWithAndCriteriaWith(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - findFirst() - Criteria::with()');
+
+        $customer = Customers::findFirst(
+            [
+                'cst_id = 2',
+                'with' => ['invoices'],
+            ]
+        );
+
+        $I->assertSame(2, $this->queries);
+        $I->assertCount(1, $customer->invoices);
+        $I->assertSame(2, $this->queries);
+
+        $invoices = Invoices::query()
+            ->where('inv_status_flag = :status:')
+            ->bind(['status' => Invoices::STATUS_PAID])
+            ->orderBy('inv_id')
+            ->with(['customer'])
+            ->execute();
+
+        $I->assertSame(4, $this->queries);
+        $I->assertCount(3, $invoices);
+
+        foreach ($invoices as $invoice) {
+            $invoice->customer;
+        }
+
+        $I->assertSame(4, $this->queries);
+
+        $I->expectThrowable(
+            new Exception(
+                "There is no defined relations for the model '" .
+                Invoices::class . "' using alias 'unknown'"
+            ),
+            function () {
+                Invoices::find(
+                    [
+                        'with' => ['unknown'],
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() with eager loaded relations that are
+     * invalidated afterwards
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindWithInvalidated(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with invalidated');
+
+        $invoice = Invoices::findFirst(
+            [
+                'inv_id = 1',
+                'with' => ['customer'],
+            ]
+        );
+
+        $I->assertSame(2, $this->queries);
+        $I->assertEquals(1, $invoice->customer->cst_id);
+
+        /**
+         * Changing the foreign key loads the new related record
+         */
+        $invoice->inv_cst_id = 2;
+
+        $I->assertEquals(2, $invoice->customer->cst_id);
+        $I->assertSame(3, $this->queries);
+
+        /**
+         * Refreshing the record drops the eager loaded relations
+         */
+        $invoice = Invoices::findFirst(
+            [
+                'inv_id = 1',
+                'with' => ['customer'],
+            ]
+        );
+
+        $invoice->refresh();
+
+        $I->assertFalse($invoice->isRelationshipLoaded('customer'));
+
+        $queries = $this->queries;
+
+        $I->assertEquals(1, $invoice->customer->cst_id);
+        $I->assertSame($queries + 1, $this->queries);
+
+        /**
+         * Assigning the relation replaces the eager loaded record
+         */
+        $invoice = Invoices::findFirst(
+            [
+                'inv_id = 1',
+                'with' => ['customer'],
+            ]
+        );
+
+        $invoice->customer = Customers::findFirst(2);
+
+        $I->assertEquals(2, $invoice->customer->cst_id);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() with relations and a hydration
+     * other than records
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindWithHydration(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with hydration');
+
+        $I->expectThrowable(
+            new Exception(
+                'Relations can only be eager loaded into resultsets hydrated as records'
+            ),
+            function () {
+                Invoices::find(
+                    [
+                        'hydration' => Resultset::HYDRATE_ARRAYS,
+                        'with'      => ['customer'],
+                    ]
+                );
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception(
+                'Relations can only be eager loaded into records'
+            ),
+            function () {
+                Invoices::findFirst(
+                    [
+                        'columns' => 'inv_id, inv_cst_id',
+                        'with'    => ['customer'],
+                    ]
+                );
+            }
+        );
+    }
+}
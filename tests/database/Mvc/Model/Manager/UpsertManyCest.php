@@ -0,0 +1,164 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Manager;
+
+use DatabaseTester;
+use Phalcon\Db\Dialect\Mysql;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+use Phalcon\Tests\Models\InvoicesMap;
+
+class UpsertManyCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: upsertMany()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerUpsertMany(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - upsertMany()');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->insert(1, 1, 0, 'first', 10);
+        $migration->insert(2, 1, 0, 'second', 20);
+
+        $invoices = [];
+        foreach ([1 => 'first updated', 2 => 'second updated', 3 => 'third'] as $id => $title) {
+            $invoice                  = new Invoices();
+            $invoice->inv_id          = $id;
+            $invoice->inv_cst_id      = 2;
+            $invoice->inv_status_flag = 1;
+            $invoice->inv_title       = $title;
+            $invoice->inv_total       = 30.0;
+
+            $invoices[] = $invoice;
+        }
+
+        $manager = $this->container->get('modelsManager');
+
+        $I->assertTrue(
+            $manager->upsertMany($invoices, null, ['inv_title'])
+        );
+
+        $I->assertSame(3, Invoices::count());
+        $I->assertSame('first updated', Invoices::findFirst(1)->inv_title);
+        $I->assertSame('second updated', Invoices::findFirst(2)->inv_title);
+        $I->assertSame('third', Invoices::findFirst(3)->inv_title);
+
+        /**
+         * Only the update fields change on existing rows
+         */
+        $I->assertEquals(1, Invoices::findFirst(1)->inv_cst_id);
+        $I->assertEquals(2, Invoices::findFirst(3)->inv_cst_id);
+
+        foreach ($invoices as $invoice) {
+            $I->assertSame(
+                Model::DIRTY_STATE_PERSISTENT,
+                $invoice->getDirtyState()
+            );
+        }
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: upsertMany() - column map
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelUpsertManyColumnMap(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - upsertMany() - column map');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->insert(1, 1, 0, 'first', 10);
+
+        $invoices = [];
+        foreach ([1 => 'first updated', 2 => 'second'] as $id => $title) {
+            $invoice              = new InvoicesMap();
+            $invoice->id          = $id;
+            $invoice->cst_id      = 2;
+            $invoice->status_flag = 1;
+            $invoice->title       = $title;
+            $invoice->total       = 30.0;
+
+            $invoices[] = $invoice;
+        }
+
+        $I->assertTrue(
+            InvoicesMap::upsertMany($invoices, ['id'], ['title'])
+        );
+
+        $I->assertSame('first updated', InvoicesMap::findFirst(1)->title);
+        $I->assertEquals(1, InvoicesMap::findFirst(1)->cst_id);
+        $I->assertSame('second', InvoicesMap::findFirst(2)->title);
+
+        $I->expectThrowable(
+            new Exception(
+                "Column 'inv_title' in '" . InvoicesMap::class . "' isn't part of the column map"
+            ),
+            function () use ($invoices) {
+                InvoicesMap::upsertMany($invoices, ['id'], ['inv_title']);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: upsert() - row alias
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     */
+    public function dbDialectMysqlUpsertRowAlias(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - upsert() - row alias');
+
+        $dialect = new Mysql();
+        $sql     = 'INSERT INTO `robots` (`id`, `name`) VALUES (?, ?)';
+
+        $I->assertSame(
+            $sql . ' ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)',
+            $dialect->upsert($sql, ['id'], ['name'])
+        );
+
+        $I->assertSame(
+            $sql . ' AS `new` ON DUPLICATE KEY UPDATE `name` = `new`.`name`',
+            $dialect->upsert($sql, ['id'], ['name'], true)
+        );
+    }
+}
@@ -0,0 +1,184 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\MetaData\Adapter;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model\MetaData\Compiled;
+use Phalcon\Tests\Fixtures\Migrations\CustomersMigration;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Customers;
+use Phalcon\Tests\Models\Invoices;
+
+use function clearstatcache;
+use function fileinode;
+use function outputDir;
+
+final class CompiledCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        $connection = $I->getConnection();
+
+        (new CustomersMigration($connection));
+        (new InvoicesMigration($connection));
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\MetaData\Compiled :: read()/write()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelMetadataCompiled(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\MetaData\Compiled - read()/write()');
+
+        $file = outputDir('metadata-compiled.php');
+        $I->safeDeleteFile($file);
+
+        $adapter = new Compiled(
+            [
+                'metaDataFile' => $file,
+            ]
+        );
+
+        $I->assertSame($file, $adapter->getMetaDataFile());
+
+        $this->container->setShared('modelsMetadata', $adapter);
+
+        $invoices  = $adapter->getAttributes(new Invoices());
+        $customers = $adapter->getAttributes(new Customers());
+
+        /**
+         * The file is written once, when the entries are flushed
+         */
+        $I->dontSeeFileFound($file);
+
+        $adapter->flush();
+
+        /**
+         * Every model is stored in the same file
+         */
+        $I->seeFileFound($file);
+
+        $compiled = require $file;
+        $I->assertIsArray($compiled);
+        $I->assertArrayHasKey('meta-phalcon\tests\models\invoices', $compiled);
+        $I->assertArrayHasKey('meta-phalcon\tests\models\customers', $compiled);
+        $I->assertArrayHasKey('map-phalcon\tests\models\invoices', $compiled);
+        $I->assertArrayHasKey('map-phalcon\tests\models\customers', $compiled);
+
+        /**
+         * A new instance reads the meta-data from the compiled file
+         */
+        $adapter = new Compiled(
+            [
+                'metaDataFile' => $file,
+            ]
+        );
+
+        $I->assertSame(
+            $compiled['meta-phalcon\tests\models\invoices'],
+            $adapter->read('meta-phalcon\tests\models\invoices')
+        );
+        $I->assertNull($adapter->read('meta-unknown'));
+        $I->assertSame($invoices, $adapter->getAttributes(new Invoices()));
+        $I->assertSame($customers, $adapter->getAttributes(new Customers()));
+
+        $adapter->reset();
+
+        $I->dontSeeFileFound($file);
+        $I->assertNull($adapter->read('meta-phalcon\tests\models\invoices'));
+        $I->assertTrue($adapter->isEmpty());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\MetaData\Compiled :: flush() - concurrent
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelMetadataCompiledFlushConcurrent(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\MetaData\Compiled - flush() - concurrent');
+
+        $file = outputDir('metadata-compiled.php');
+        $I->safeDeleteFile($file);
+
+        $first  = new Compiled(
+            [
+                'metaDataFile' => $file,
+            ]
+        );
+        $second = new Compiled(
+            [
+                'metaDataFile' => $file,
+            ]
+        );
+
+        /**
+         * Both instances load the file before any of them writes it
+         */
+        $I->assertNull($first->read('meta-first'));
+        $I->assertNull($second->read('meta-second'));
+
+        $first->write('meta-first', ['first']);
+        $first->flush();
+
+        $second->write('meta-second', ['second']);
+        $second->flush();
+
+        $compiled = require $file;
+        $I->assertSame(
+            [
+                'meta-first'  => ['first'],
+                'meta-second' => ['second'],
+            ],
+            $compiled
+        );
+
+        /**
+         * The entries of the other worker are merged into the instance
+         */
+        $I->assertSame(['first'], $second->read('meta-first'));
+
+        $inode = fileinode($file);
+        $first->write('meta-second', ['other']);
+        $first->flush();
+
+        /**
+         * Entries already compiled by another worker are not written again
+         */
+        clearstatcache();
+        $I->assertSame($inode, fileinode($file));
+        $I->assertSame(['second'], $first->read('meta-second'));
+
+        $I->safeDeleteFile($file);
+        $I->safeDeleteFile($file . '.lock');
+    }
+}
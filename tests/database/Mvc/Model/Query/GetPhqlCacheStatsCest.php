@@ -0,0 +1,147 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Query;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\Query;
+use Phalcon\Storage\Exception;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+class GetPhqlCacheStatsCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param DatabaseTester $I
+     *
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        Query::cleanPhqlCache();
+    }
+
+    /**
+     * Executed after each test
+     *
+     * @param DatabaseTester $I
+     *
+     * @return void
+     */
+    public function _after(DatabaseTester $I): void
+    {
+        Model::setup(['phqlCacheSize' => 0]);
+
+        Query::cleanPhqlCache();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: getPhqlCacheStats()
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQueryGetPhqlCacheStats(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query :: getPhqlCacheStats()');
+
+        $expected = [
+            'entries'   => 0,
+            'memory'    => 0,
+            'hits'      => 0,
+            'misses'    => 0,
+            'evictions' => 0,
+        ];
+        $I->assertSame($expected, Query::getPhqlCacheStats());
+
+        Model::setup(['phqlCacheSize' => 10]);
+
+        $phql = sprintf('SELECT i.inv_id FROM [%s] AS i', Invoices::class);
+
+        $query = new Query($phql, $this->container);
+        $first = $query->getSql();
+
+        /**
+         * AST and intermediate representation
+         */
+        $stats = Query::getPhqlCacheStats();
+        $I->assertSame(2, $stats['entries']);
+        $I->assertSame(0, $stats['hits']);
+        $I->assertSame(2, $stats['misses']);
+        $I->assertGreaterThan(0, $stats['memory']);
+
+        /**
+         * Simulates a new request by removing the request level caches
+         */
+        Query::clean();
+
+        $query = new Query($phql, $this->container);
+        $I->assertSame($first, $query->getSql());
+
+        $stats = Query::getPhqlCacheStats();
+        $I->assertSame(2, $stats['entries']);
+        $I->assertSame(1, $stats['hits']);
+
+        Query::cleanPhqlCache();
+
+        $I->assertSame($expected, Query::getPhqlCacheStats());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: getPhqlCacheStats() - evictions
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQueryGetPhqlCacheStatsEvictions(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query :: getPhqlCacheStats() - evictions');
+
+        Model::setup(['phqlCacheSize' => 2]);
+
+        foreach (['inv_id', 'inv_cst_id', 'inv_title'] as $column) {
+            $phql  = sprintf('SELECT i.%s FROM [%s] AS i', $column, Invoices::class);
+            $query = new Query($phql, $this->container);
+            $query->getSql();
+        }
+
+        $stats = Query::getPhqlCacheStats();
+        $I->assertSame(2, $stats['entries']);
+        $I->assertSame(4, $stats['evictions']);
+    }
+}
@@ -0,0 +1,316 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Resultset;
+
+use DatabaseTester;
+use Phalcon\Db\Column;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+use function codecept_debug;
+use function count;
+use function file_get_contents;
+use function file_put_contents;
+use function function_exists;
+use function gc_collect_cycles;
+use function is_writable;
+use function memory_get_peak_usage;
+use function memory_reset_peak_usage;
+use function preg_match;
+use function spl_object_id;
+use function sprintf;
+
+final class StreamCest
+{
+    use DiTrait;
+
+    /**
+     * @var InvoicesMigration
+     */
+    private $invoiceMigration;
+
+    public function _before(DatabaseTester $I): void
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        $this->invoiceMigration = new InvoicesMigration($I->getConnection());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: isStream()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelResultsetStream(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - stream');
+
+        $this->insertInvoices(100);
+
+        $invoices = Invoices::find(
+            [
+                'order'  => 'inv_id',
+                'stream' => true,
+            ]
+        );
+
+        $I->assertTrue($invoices->isStream());
+
+        $objects = [];
+        $titles  = [];
+        foreach ($invoices as $invoice) {
+            $objects[spl_object_id($invoice)] = true;
+            $titles[]                         = $invoice->inv_title;
+        }
+
+        /**
+         * Every row is hydrated into the same record
+         */
+        $I->assertCount(1, $objects);
+        $I->assertCount(100, $titles);
+        $I->assertSame('title 1', $titles[0]);
+        $I->assertSame('title 100', $titles[99]);
+
+        $I->expectThrowable(
+            new Exception('Streamed resultsets cannot be counted'),
+            function () use ($invoices) {
+                count($invoices);
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception('Streamed resultsets can only be traversed forward'),
+            function () use ($invoices) {
+                foreach ($invoices as $invoice) {
+                }
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception('Streamed resultsets cannot be exported to an array'),
+            function () use ($invoices) {
+                $invoices->toArray();
+            }
+        );
+
+        $I->assertFalse(Invoices::find()->isStream());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: isStream() - hydrate arrays
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelResultsetStreamArrays(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - stream - hydrate arrays');
+
+        $this->insertInvoices(10);
+
+        $invoices = Invoices::find(
+            [
+                'inv_total > 5',
+                'order'     => 'inv_id',
+                'hydration' => Resultset::HYDRATE_ARRAYS,
+                'stream'    => true,
+            ]
+        );
+
+        $totals = [];
+        foreach ($invoices as $invoice) {
+            $I->assertIsArray($invoice);
+
+            $totals[] = (int) $invoice['inv_total'];
+        }
+
+        $I->assertSame([6, 7, 8, 9, 10], $totals);
+
+        $I->expectThrowable(
+            new Exception('Streamed resultsets cannot be cached'),
+            function () {
+                Invoices::find(
+                    [
+                        'cache'  => [
+                            'key' => 'stream-cache',
+                        ],
+                        'stream' => true,
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset :: isStream() - memory
+     *
+     * Compares the peak memory and the peak RSS growth of the process while
+     * iterating resultsets of a growing number of rows, buffered and
+     * streamed. The RSS covers the rows buffered by the client libraries,
+     * which are not allocated by the PHP memory manager.
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelResultsetStreamMemory(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - stream - memory');
+
+        if (!function_exists('memory_reset_peak_usage')) {
+            $I->markTestSkipped('memory_reset_peak_usage() is not available');
+        }
+
+        $inserted = 0;
+        $streamed = [];
+        foreach ([2000, 20000] as $rows) {
+            $this->insertInvoices($rows - $inserted, $inserted);
+            $inserted = $rows;
+
+            $buffered = $this->measure(false);
+            $streamed[$rows] = $this->measure(true);
+
+            codecept_debug(
+                sprintf(
+                    '%6d rows - buffered: %8d bytes peak, %6d kB RSS - ' .
+                    'streamed: %8d bytes peak, %6d kB RSS',
+                    $rows,
+                    $buffered[0],
+                    $buffered[1],
+                    $streamed[$rows][0],
+                    $streamed[$rows][1]
+                )
+            );
+        }
+
+        /**
+         * Ten times the rows must not need more memory when streamed
+         */
+        $I->assertLessThan(
+            $streamed[2000][0] + 262144,
+            $streamed[20000][0]
+        );
+
+        if (null === $streamed[20000][1]) {
+            $I->markTestSkipped('The peak RSS of the process cannot be reset');
+        }
+
+        $I->assertLessThan(
+            $streamed[2000][1] + 1024,
+            $streamed[20000][1]
+        );
+    }
+
+    /**
+     * Inserts invoices with consecutive titles and totals
+     */
+    private function insertInvoices(int $count, int $offset = 0): void
+    {
+        $rows = [];
+        for ($counter = $offset + 1; $counter <= $offset + $count; $counter++) {
+            $rows[] = [
+                1,
+                1,
+                'title ' . $counter,
+                $counter,
+            ];
+        }
+
+        $this->container->get('db')->insertBatch(
+            $this->invoiceMigration->getTable(),
+            $rows,
+            [
+                'inv_cst_id',
+                'inv_status_flag',
+                'inv_title',
+                'inv_total',
+            ],
+            [
+                Column::BIND_PARAM_INT,
+                Column::BIND_PARAM_INT,
+                Column::BIND_PARAM_STR,
+                Column::BIND_PARAM_DECIMAL,
+            ]
+        );
+    }
+
+    /**
+     * Returns the peak memory growth and the peak RSS growth in kB while
+     * iterating all the invoices. The RSS growth is null when the peak RSS of
+     * the process cannot be reset
+     */
+    private function measure(bool $stream): array
+    {
+        gc_collect_cycles();
+
+        $rss = null;
+        if (
+            is_writable('/proc/self/clear_refs') &&
+            false !== file_put_contents('/proc/self/clear_refs', '5')
+        ) {
+            $rss = $this->readStatus('VmHWM');
+        }
+
+        memory_reset_peak_usage();
+        $start = memory_get_peak_usage();
+
+        $invoices = Invoices::find(
+            [
+                'stream' => $stream,
+            ]
+        );
+
+        foreach ($invoices as $invoice) {
+        }
+
+        $peak = memory_get_peak_usage() - $start;
+
+        if (null !== $rss) {
+            $rss = $this->readStatus('VmHWM') - $rss;
+        }
+
+        unset($invoices, $invoice);
+
+        return [$peak, $rss];
+    }
+
+    /**
+     * Returns a kB figure of /proc/self/status
+     */
+    private function readStatus(string $name): int
+    {
+        $status = (string) file_get_contents('/proc/self/status');
+        if (preg_match('/' . $name . ':\s+(\d+)/', $status, $matches)) {
+            return (int) $matches[1];
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,213 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model;
+use Phalcon\Tests\Fixtures\Migrations\CustomersMigration;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Customers;
+use Phalcon\Tests\Models\Invoices;
+use Phalcon\Tests\Models\InvoicesKeepSnapshots;
+use Phalcon\Tests\Models\InvoicesValidationFails;
+
+class SaveManyCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+    }
+
+    public function _after(DatabaseTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: saveMany()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelSaveMany(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - saveMany()');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+
+        $existing                  = new InvoicesKeepSnapshots();
+        $existing->inv_cst_id      = 1;
+        $existing->inv_status_flag = 0;
+        $existing->inv_title       = 'existing';
+        $existing->inv_total       = 10.0;
+        $I->assertTrue($existing->save());
+
+        $existing->inv_title = 'updated';
+
+        $invoices = [$existing];
+
+        /**
+         * Explicit identities, inserted in one statement
+         */
+        for ($id = 10; $id < 13; $id++) {
+            $invoice                  = new InvoicesKeepSnapshots();
+            $invoice->inv_id          = $id;
+            $invoice->inv_cst_id      = 2;
+            $invoice->inv_status_flag = 1;
+            $invoice->inv_title       = 'batch ' . $id;
+            $invoice->inv_total       = 100.0;
+
+            $invoices[] = $invoice;
+        }
+
+        /**
+         * Generated identity, inserted on its own
+         */
+        $generated                  = new InvoicesKeepSnapshots();
+        $generated->inv_cst_id      = 3;
+        $generated->inv_status_flag = 0;
+        $generated->inv_title       = 'generated';
+        $generated->inv_total       = 50.0;
+
+        $invoices[] = $generated;
+
+        $I->assertTrue(
+            InvoicesKeepSnapshots::saveMany($invoices)
+        );
+
+        $I->assertSame(5, Invoices::count());
+        $I->assertSame(3, Invoices::count('inv_cst_id = 2'));
+        $I->assertSame(
+            'updated',
+            Invoices::findFirst($existing->inv_id)->inv_title
+        );
+
+        $I->assertNotEmpty($generated->inv_id);
+        $I->assertSame(
+            'generated',
+            Invoices::findFirst($generated->inv_id)->inv_title
+        );
+
+        foreach ($invoices as $invoice) {
+            $I->assertSame(
+                Model::DIRTY_STATE_PERSISTENT,
+                $invoice->getDirtyState()
+            );
+            $I->assertTrue($invoice->hasSnapshotData());
+            $I->assertFalse($invoice->hasChanged());
+        }
+
+        $I->assertSame(Model::OP_UPDATE, $existing->getOperationMade());
+        $I->assertSame(Model::OP_CREATE, $invoices[1]->getOperationMade());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: saveMany() - validation fails
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelSaveManyValidationFails(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - saveMany() - validation fails');
+
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+
+        $valid             = new Invoices();
+        $valid->inv_id     = 1;
+        $valid->inv_cst_id = 1;
+        $valid->inv_title  = 'valid';
+
+        $invalid             = new InvoicesValidationFails();
+        $invalid->inv_id     = 2;
+        $invalid->inv_cst_id = 1;
+        $invalid->inv_title  = 'invalid';
+
+        $I->assertFalse(
+            Invoices::saveMany([$valid, $invalid])
+        );
+
+        /**
+         * Nothing is written when a record fails
+         */
+        $I->assertSame(0, Invoices::count());
+        $I->assertSame(
+            Model::DIRTY_STATE_TRANSIENT,
+            $valid->getDirtyState()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: saveMany() - related record fails
+     *
+     * Records with related records are saved with save() in the
+     * transaction, so a related record failing rolls every record back
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelSaveManyRelatedFails(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - saveMany() - related record fails');
+
+        $connection = $I->getConnection();
+        $customers  = new CustomersMigration($connection);
+        $migration  = new InvoicesMigration($connection);
+
+        $valid             = new Invoices();
+        $valid->inv_id     = 1;
+        $valid->inv_cst_id = 1;
+        $valid->inv_title  = 'valid';
+
+        $invalid            = new InvoicesValidationFails();
+        $invalid->inv_id    = 2;
+        $invalid->inv_title = 'invalid';
+
+        $customer                  = new Customers();
+        $customer->cst_id          = 1;
+        $customer->cst_status_flag = 1;
+        $customer->cst_name_last   = 'last';
+        $customer->cst_name_first  = 'first';
+        $customer->invoices        = [$invalid];
+
+        $I->assertFalse(
+            Invoices::saveMany([$valid, $customer])
+        );
+
+        $I->assertSame(0, Invoices::count());
+        $I->assertSame(0, Customers::count());
+        $I->assertSame(
+            Model::DIRTY_STATE_TRANSIENT,
+            $valid->getDirtyState()
+        );
+    }
+}
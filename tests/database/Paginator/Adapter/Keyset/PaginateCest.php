@@ -0,0 +1,199 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Paginator\Adapter\Keyset;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Paginator\Adapter\Keyset;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\Repository;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Fixtures\Traits\RecordsTrait;
+use Phalcon\Tests\Models\Invoices;
+
+use function array_column;
+use function array_map;
+use function array_reverse;
+use function array_slice;
+
+class PaginateCest
+{
+    use DiTrait;
+    use RecordsTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        (new InvoicesMigration($connection));
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginate(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate()');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 7, $invId, 2, 'ccc');
+        $this->insertDataInvoices($migration, 5, $invId, 1, 'aaa');
+
+        $manager = $this->getService('modelsManager');
+        $builder = $manager
+            ->createBuilder()
+            ->from(Invoices::class)
+        ;
+
+        $expected = Invoices::find(['order' => 'inv_cst_id, inv_id'])->toArray();
+        $expected = array_map('intval', array_column($expected, 'inv_id'));
+
+        $paginator = new Keyset(
+            [
+                'builder' => $builder,
+                'columns' => ['inv_cst_id', 'inv_id'],
+                'limit'   => 5,
+            ]
+        );
+
+        /**
+         * First page
+         */
+        $page = $paginator->paginate();
+
+        $I->assertInstanceOf(Repository::class, $page);
+        $I->assertSame(array_slice($expected, 0, 5), $this->getIds($page));
+        $I->assertSame(5, $page->getLimit());
+        $I->assertNull($page->getPreviousCursor());
+        $I->assertNotNull($page->getNextCursor());
+
+        /**
+         * Middle page
+         */
+        $paginator->setCursor($page->getNextCursor());
+        $page = $paginator->paginate();
+
+        $I->assertSame(array_slice($expected, 5, 5), $this->getIds($page));
+        $I->assertNotNull($page->getPreviousCursor());
+        $I->assertNotNull($page->getNextCursor());
+
+        $middle = $page->getPreviousCursor();
+
+        /**
+         * Last page
+         */
+        $paginator->setCursor($page->getNextCursor());
+        $page = $paginator->paginate();
+
+        $I->assertSame(array_slice($expected, 10, 5), $this->getIds($page));
+        $I->assertNull($page->getNextCursor());
+        $I->assertNotNull($page->getPreviousCursor());
+
+        /**
+         * Back to the first page
+         */
+        $paginator->setCursor($middle);
+        $page = $paginator->paginate();
+
+        $I->assertSame(array_slice($expected, 0, 5), $this->getIds($page));
+        $I->assertNull($page->getPreviousCursor());
+        $I->assertNotNull($page->getNextCursor());
+
+        /**
+         * Descending order
+         */
+        $paginator = new Keyset(
+            [
+                'builder' => $builder,
+                'columns' => ['inv_cst_id', 'inv_id'],
+                'limit'   => 5,
+                'order'   => 'DESC',
+            ]
+        );
+
+        $reversed = array_reverse($expected);
+
+        $page = $paginator->paginate();
+        $I->assertSame(array_slice($reversed, 0, 5), $this->getIds($page));
+
+        $paginator->setCursor($page->getNextCursor());
+        $page = $paginator->paginate();
+        $I->assertSame(array_slice($reversed, 5, 5), $this->getIds($page));
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - invalid cursor
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginateInvalidCursor(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - invalid cursor');
+
+        $manager = $this->getService('modelsManager');
+        $builder = $manager
+            ->createBuilder()
+            ->from(Invoices::class)
+        ;
+
+        $paginator = new Keyset(
+            [
+                'builder' => $builder,
+                'columns' => ['inv_id'],
+                'limit'   => 5,
+                'cursor'  => 'not-a-cursor',
+            ]
+        );
+
+        $I->expectThrowable(
+            new Exception('The cursor is not valid'),
+            function () use ($paginator) {
+                $paginator->paginate();
+            }
+        );
+    }
+
+    /**
+     * @return int[]
+     */
+    private function getIds(Repository $page): array
+    {
+        $ids = [];
+        foreach ($page->getItems() as $item) {
+            $ids[] = (int) $item->inv_id;
+        }
+
+        return $ids;
+    }
+}
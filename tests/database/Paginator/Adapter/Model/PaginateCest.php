@@ -15,9 +15,11 @@ namespace Phalcon\Tests\Database\Paginator\Adapter\Model;
 
 use DatabaseTester;
 use PDO;
+use Phalcon\Cache\Adapter\Memory;
 use Phalcon\Paginator\Adapter\Model;
 use Phalcon\Paginator\Repository;
 use Phalcon\Storage\Exception;
+use Phalcon\Storage\SerializerFactory;
 use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
 use Phalcon\Tests\Fixtures\Traits\DiTrait;
 use Phalcon\Tests\Fixtures\Traits\RecordsTrait;
@@ -382,4 +384,57 @@ class PaginateCest
         $I->assertEquals(5, $page->getLimit());
         $I->assertEquals(1, $page->getCurrent());
     }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Model :: paginate() - countCache
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group mysql
+     * @group sqlite
+     * @group pgsql
+     */
+    public function paginatorAdapterModelPaginateCountCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Model - paginate() - countCache');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 17, $invId, 2, 'ccc');
+
+        $cache     = new Memory(new SerializerFactory());
+        $paginator = new Model(
+            [
+                'model'         => Invoices::class,
+                'limit'         => 5,
+                'page'          => 1,
+                'countCache'    => $cache,
+                'countCacheKey' => 'invoices-total',
+            ]
+        );
+
+        $page = $paginator->paginate();
+        $I->assertSame(17, $page->getTotalItems());
+        $I->assertSame(17, $cache->get('invoices-total'));
+
+        /**
+         * The cached total is used until it expires
+         */
+        $this->insertDataInvoices($migration, 11, $invId, 3, 'aaa');
+
+        $paginator->setCurrentPage(2);
+        $page = $paginator->paginate();
+        $I->assertSame(17, $page->getTotalItems());
+        $I->assertEquals(4, $page->getLast());
+        $I->assertCount(5, $page->getItems());
+
+        $cache->delete('invoices-total');
+
+        $page = $paginator->paginate();
+        $I->assertSame(28, $page->getTotalItems());
+    }
 }
@@ -14,10 +14,13 @@ declare(strict_types=1);
 namespace Phalcon\Tests\Database\Paginator\Adapter\QueryBuilder;
 
 use DatabaseTester;
+use Phalcon\Cache\Adapter\Memory;
 use Phalcon\Mvc\Model\Criteria;
 use Phalcon\Paginator\Adapter\QueryBuilder;
+use Phalcon\Paginator\Exception as PaginatorException;
 use Phalcon\Paginator\Repository;
 use Phalcon\Storage\Exception;
+use Phalcon\Storage\SerializerFactory;
 use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
 use Phalcon\Tests\Fixtures\Traits\DiTrait;
 use Phalcon\Tests\Fixtures\Traits\RecordsTrait;
@@ -227,4 +230,147 @@ class PaginateCest
         $actual = $view->getVar('paginate');
         $I->assertInstanceOf(Repository::class, $actual);
     }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\QueryBuilder :: paginate() - countCache
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterQuerybuilderPaginateCountCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\QueryBuilder - paginate() - countCache');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 17, $invId, 2, 'ccc');
+
+        $manager = $this->getService('modelsManager');
+        $builder = $manager
+            ->createBuilder()
+            ->from(Invoices::class)
+            ->where('inv_cst_id = :cst:', ['cst' => 2])
+        ;
+
+        $cache     = new Memory(new SerializerFactory());
+        $paginator = new QueryBuilder(
+            [
+                'builder'    => $builder,
+                'limit'      => 5,
+                'page'       => 1,
+                'countCache' => $cache,
+            ]
+        );
+
+        $page = $paginator->paginate();
+        $I->assertSame(17, $page->getTotalItems());
+        $I->assertCount(1, $cache->getKeys());
+
+        /**
+         * The cached total is used until it expires
+         */
+        $this->insertDataInvoices($migration, 3, $invId, 2, 'aaa');
+
+        $page = $paginator->paginate();
+        $I->assertSame(17, $page->getTotalItems());
+
+        /**
+         * Other bound values are counted on their own
+         */
+        $builder->where('inv_cst_id = :cst:', ['cst' => 3]);
+
+        $page = $paginator->paginate();
+        $I->assertSame(0, $page->getTotalItems());
+        $I->assertCount(2, $cache->getKeys());
+
+        $I->expectThrowable(
+            new PaginatorException(
+                "Parameter 'countCache' must be an instance of " .
+                "Phalcon\\Cache\\CacheInterface or " .
+                "Phalcon\\Cache\\Adapter\\AdapterInterface"
+            ),
+            function () use ($builder) {
+                new QueryBuilder(
+                    [
+                        'builder'    => $builder,
+                        'limit'      => 5,
+                        'countCache' => 'cache',
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\QueryBuilder :: paginate() - countEstimate
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @group  mysql
+     * @group  pgsql
+     */
+    public function paginatorAdapterQuerybuilderPaginateCountEstimate(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\QueryBuilder - paginate() - countEstimate');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+
+        $this->insertDataInvoices($migration, 17, 'default', 2, 'ccc');
+
+        $manager = $this->getService('modelsManager');
+        $builder = $manager
+            ->createBuilder()
+            ->from(Invoices::class)
+        ;
+
+        $paginator = new QueryBuilder(
+            [
+                'builder'       => $builder,
+                'limit'         => 5,
+                'page'          => 1,
+                'countEstimate' => true,
+            ]
+        );
+
+        /**
+         * The planner estimate depends on the table statistics
+         */
+        $page = $paginator->paginate();
+        $I->assertCount(5, $page->getItems());
+        $I->assertTrue(is_int($page->getTotalItems()));
+        $I->assertGreaterOrEquals(0, $page->getTotalItems());
+
+        /**
+         * Grouped queries are counted
+         */
+        $builder = $manager
+            ->createBuilder()
+            ->columns('inv_cst_id')
+            ->from(Invoices::class)
+            ->groupBy('inv_cst_id')
+        ;
+
+        $paginator = new QueryBuilder(
+            [
+                'builder'       => $builder,
+                'limit'         => 5,
+                'page'          => 1,
+                'countEstimate' => true,
+            ]
+        );
+
+        $page = $paginator->paginate();
+        $I->assertSame(1, $page->getTotalItems());
+        $I->assertSame(1, $page->getLast());
+    }
 }
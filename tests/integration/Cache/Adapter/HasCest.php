@@ -91,7 +91,7 @@ class HasCest
                 ],
             ],
             [
-                'phpFileGetContents' => false,
+                'phpFread' => false,
             ]
         );
 
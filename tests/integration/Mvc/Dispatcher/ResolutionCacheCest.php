@@ -0,0 +1,260 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\Dispatcher;
+
+use IntegrationTester;
+use Phalcon\Di\Di;
+use Phalcon\Mvc\Dispatcher;
+use Phalcon\Tests\Controllers\AboutController;
+use Phalcon\Tests\Integration\Mvc\Dispatcher\Helper\BaseDispatcher;
+use Phalcon\Tests\Integration\Mvc\Dispatcher\Helper\DispatcherTestDefaultController;
+use ReflectionClass;
+
+use function codecept_debug;
+use function file_put_contents;
+use function filemtime;
+use function hrtime;
+use function outputDir;
+use function sprintf;
+use function var_export;
+
+class ResolutionCacheCest extends BaseDispatcher
+{
+    /**
+     * Number of dispatches measured by the benchmark
+     */
+    private const DISPATCHES = 20000;
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: setResolutionCache()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcDispatcherSetResolutionCache(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - setResolutionCache()');
+
+        $file = outputDir('dispatcher-resolution.php');
+        $I->safeDeleteFile($file);
+
+        $expected = [
+            'beforeDispatchLoop',
+            'beforeDispatch',
+            'beforeExecuteRoute',
+            'beforeExecuteRoute-method',
+            'initialize-method',
+            'afterInitialize',
+            'indexAction',
+            'afterExecuteRoute',
+            'afterExecuteRoute-method',
+            'afterDispatch',
+            'afterDispatchLoop',
+        ];
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache(true, $file);
+
+        $I->assertTrue($dispatcher->isResolutionCaching());
+
+        $handler = $dispatcher->dispatch();
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame($expected, $this->getDispatcherListener()->getTrace());
+
+        /**
+         * The file is written once, when the resolutions are flushed
+         */
+        $I->dontSeeFileFound($file);
+
+        $dispatcher->flushResolutionCache();
+
+        $I->seeFileFound($file);
+
+        $handlerFile = (new ReflectionClass(DispatcherTestDefaultController::class))
+            ->getFileName();
+
+        $key = Dispatcher::class
+            . '|Phalcon\Tests\Integration\Mvc\Dispatcher\Helper'
+            . '|dispatcher-test-default|Controller|index|Action';
+
+        $data = require $file;
+        $I->assertSame(
+            [
+                'class'   => DispatcherTestDefaultController::class,
+                'handler' => DispatcherTestDefaultController::class,
+                'method'  => 'indexAction',
+                'hooks'   => [
+                    'afterBinding'       => false,
+                    'afterExecuteRoute'  => true,
+                    'beforeExecuteRoute' => true,
+                    'initialize'         => true,
+                ],
+                'file'    => $handlerFile,
+                'mtime'   => filemtime($handlerFile),
+            ],
+            $data[$key]
+        );
+
+        /**
+         * A new dispatcher, as in the next request, uses the file and runs
+         * the same events and methods
+         */
+        $this->_before($I);
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache(true, $file);
+
+        $handler = $dispatcher->dispatch();
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame($expected, $this->getDispatcherListener()->getTrace());
+
+        /**
+         * A resolution cached before the handler class was modified is
+         * resolved again, so the hooks of the new class are called
+         */
+        $data[$key]['hooks'] = [
+            'afterBinding'       => false,
+            'afterExecuteRoute'  => false,
+            'beforeExecuteRoute' => false,
+            'initialize'         => false,
+        ];
+        $data[$key]['mtime'] = $data[$key]['mtime'] - 10;
+        file_put_contents($file, '<?php return ' . var_export($data, true) . ';');
+
+        $this->_before($I);
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache(true, $file);
+
+        $handler = $dispatcher->dispatch();
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame($expected, $this->getDispatcherListener()->getTrace());
+
+        $dispatcher->flushResolutionCache();
+
+        $data = require $file;
+        $I->assertTrue($data[$key]['hooks']['beforeExecuteRoute']);
+        $I->assertSame(filemtime($handlerFile), $data[$key]['mtime']);
+
+        $dispatcher->clearResolutionCache();
+        $I->dontSeeFileFound($file);
+        $I->safeDeleteFile($file . '.lock');
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: setResolutionCache() - without stat
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcDispatcherSetResolutionCacheNoStat(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - setResolutionCache() - without stat');
+
+        $file = outputDir('dispatcher-resolution-stat.php');
+        $I->safeDeleteFile($file);
+
+        $key = Dispatcher::class
+            . '|Phalcon\Tests\Integration\Mvc\Dispatcher\Helper'
+            . '|dispatcher-test-default|Controller|index|Action';
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache(true, $file, false);
+        $dispatcher->dispatch();
+        $dispatcher->flushResolutionCache();
+
+        $data  = require $file;
+        $mtime = $data[$key]['mtime'] - 10;
+
+        $data[$key]['mtime'] = $mtime;
+        file_put_contents($file, '<?php return ' . var_export($data, true) . ';');
+
+        /**
+         * The resolution is used as it is, without checking the class file
+         */
+        $this->_before($I);
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache(true, $file, false);
+
+        $handler = $dispatcher->dispatch();
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+
+        $dispatcher->flushResolutionCache();
+
+        $data = require $file;
+        $I->assertSame($mtime, $data[$key]['mtime']);
+
+        $dispatcher->clearResolutionCache();
+        $I->dontSeeFileFound($file);
+        $I->safeDeleteFile($file . '.lock');
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: dispatch() - empty action overhead
+     *
+     * Dispatches an empty action without the resolution cache, and with it
+     * with and without stat, and reports the time per dispatch. Run with
+     * --debug to see the figures.
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcDispatcherDispatchEmptyActionOverhead(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - dispatch() - empty action overhead');
+
+        $file = outputDir('dispatcher-benchmark.php');
+        $I->safeDeleteFile($file);
+
+        $modes = [
+            'No cache'                  => [false, null, true],
+            'Resolution cache'          => [true, $file, true],
+            'Resolution cache, no stat' => [true, $file, false],
+        ];
+
+        foreach ($modes as $label => [$caching, $cacheFile, $stat]) {
+            $container  = new Di();
+            $dispatcher = new Dispatcher();
+            $dispatcher->setDI($container);
+            $dispatcher->setResolutionCache($caching, $cacheFile, $stat);
+
+            $total = 0;
+            for ($counter = 0; $counter < self::DISPATCHES; $counter++) {
+                $dispatcher->setNamespaceName('Phalcon\Tests\Controllers');
+                $dispatcher->setControllerName('about');
+                $dispatcher->setActionName('team');
+
+                $start   = hrtime(true);
+                $dispatcher->dispatch();
+                $total   += hrtime(true) - $start;
+            }
+
+            $dispatcher->flushResolutionCache();
+
+            codecept_debug(
+                sprintf(
+                    '%s: %.2f µs per dispatch',
+                    $label,
+                    $total / self::DISPATCHES / 1000
+                )
+            );
+        }
+
+        $I->assertInstanceOf(AboutController::class, $dispatcher->getActiveController());
+
+        $I->safeDeleteFile($file);
+        $I->safeDeleteFile($file . '.lock');
+    }
+}
@@ -0,0 +1,183 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\Router;
+
+use Codeception\Example;
+use IntegrationTester;
+use Phalcon\Mvc\Router;
+use Phalcon\Mvc\Router\Exception;
+use Phalcon\Tests\Fixtures\Traits\RouterTrait;
+
+class SetCompiledMatchingCest
+{
+    use RouterTrait;
+
+    /**
+     * Tests Phalcon\Mvc\Router :: setCompiledMatching()/isCompiledMatching()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcRouterSetCompiledMatching(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router - setCompiledMatching()/isCompiledMatching()');
+
+        $router = $this->getRouter(false);
+
+        $I->assertFalse($router->isCompiledMatching());
+
+        $actual = $router->setCompiledMatching(true);
+        $I->assertInstanceOf(Router::class, $actual);
+        $I->assertTrue($router->isCompiledMatching());
+
+        $router->setCompiledMatching(false);
+        $I->assertFalse($router->isCompiledMatching());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router :: setCompiledMatching() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcRouterSetCompiledMatchingException(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router - setCompiledMatching() - exception');
+
+        $I->expectThrowable(
+            new Exception('The chunk size must be greater than zero'),
+            function () {
+                $router = $this->getRouter(false);
+                $router->setCompiledMatching(true, 0);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router :: handle() - compiled matching returns the
+     * same route as the default traversal
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     *
+     * @dataProvider getExamples
+     */
+    public function mvcRouterSetCompiledMatchingHandle(IntegrationTester $I, Example $example)
+    {
+        $I->wantToTest('Mvc\Router - setCompiledMatching() - handle() ' . $example['uri']);
+
+        $_SERVER['REQUEST_METHOD'] = $example['method'];
+
+        $default  = $this->getCompiledRouter(false);
+        $compiled = $this->getCompiledRouter(true);
+
+        foreach ([1, 2, 3] as $chunkSize) {
+            $compiled->setCompiledMatching(true, $chunkSize);
+
+            $default->handle($example['uri']);
+            $compiled->handle($example['uri']);
+
+            $I->assertSame($default->wasMatched(), $compiled->wasMatched());
+            $I->assertSame(
+                $default->getMatchedRoute()?->getPattern(),
+                $compiled->getMatchedRoute()?->getPattern()
+            );
+            $I->assertSame($default->getControllerName(), $compiled->getControllerName());
+            $I->assertSame($default->getActionName(), $compiled->getActionName());
+            $I->assertSame($default->getParams(), $compiled->getParams());
+            $I->assertSame($default->getMatches(), $compiled->getMatches());
+            $I->assertSame($example['controller'], $compiled->getControllerName());
+        }
+
+        unset($_SERVER['REQUEST_METHOD']);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router :: handle() - compiled matching is rebuilt
+     * when routes are added
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcRouterSetCompiledMatchingRebuild(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router - setCompiledMatching() - rebuild on add()');
+
+        $router = $this->getRouter(false);
+        $router->setCompiledMatching(true);
+
+        $router->add('/blog/{slug}', 'posts::view');
+
+        $router->handle('/blog/about');
+        $I->assertSame('posts', $router->getControllerName());
+
+        $router->add('/blog/about', 'pages::about');
+
+        $router->handle('/blog/about');
+        $I->assertSame('pages', $router->getControllerName());
+
+        $router->clear();
+
+        $router->handle('/blog/about');
+        $I->assertFalse($router->wasMatched());
+    }
+
+    private function getCompiledRouter(bool $compiled): Router
+    {
+        $router = $this->getRouter(true);
+
+        $router->add('/static/page', 'static::page');
+        $router->addPost('/static/page', 'post::page');
+        $router->add('/users/{id:[0-9]+}', 'users::view');
+        $router->add('/users/:action', ['controller' => 'users', 'action' => 1]);
+        $router->add('#^/named/(?P<name>[a-z]+)$#', ['controller' => 'named']);
+        $router->add('/users/me', 'me::index');
+        $router->add('/products/{id:[0-9]+}', 'products::view')
+               ->beforeMatch(
+                   function ($uri) {
+                       return '/products/0' !== $uri;
+                   }
+               )
+        ;
+        $router->add('#^/case/([a-z]+)$#i', ['controller' => 'case', 'action' => 1]);
+        $router->addGet('/feed', 'feed::index');
+        $router->add('/host', 'host::index')->setHostname('example.com');
+
+        if ($compiled) {
+            $router->setCompiledMatching(true);
+        }
+
+        return $router;
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            ['method' => 'GET', 'uri' => '/static/page', 'controller' => 'static'],
+            ['method' => 'POST', 'uri' => '/static/page', 'controller' => 'post'],
+            ['method' => 'GET', 'uri' => '/users/10', 'controller' => 'users'],
+            ['method' => 'GET', 'uri' => '/users/me', 'controller' => 'me'],
+            ['method' => 'GET', 'uri' => '/users/edit', 'controller' => 'users'],
+            ['method' => 'GET', 'uri' => '/named/phalcon', 'controller' => 'named'],
+            ['method' => 'GET', 'uri' => '/products/10', 'controller' => 'products'],
+            ['method' => 'GET', 'uri' => '/products/0', 'controller' => 'products'],
+            ['method' => 'GET', 'uri' => '/case/ABC', 'controller' => 'case'],
+            ['method' => 'GET', 'uri' => '/feed', 'controller' => 'feed'],
+            ['method' => 'POST', 'uri' => '/feed', 'controller' => 'feed'],
+            ['method' => 'GET', 'uri' => '/host', 'controller' => 'host'],
+            ['method' => 'GET', 'uri' => '/missing/route/here/', 'controller' => 'missing'],
+            ['method' => 'GET', 'uri' => '/', 'controller' => ''],
+        ];
+    }
+}
@@ -0,0 +1,135 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\View;
+
+use IntegrationTester;
+use Phalcon\Di\Di;
+use Phalcon\Mvc\View;
+
+use function array_column;
+use function clearstatcache;
+use function file_put_contents;
+use function is_dir;
+use function mkdir;
+use function outputDir;
+use function rmdir;
+use function time;
+use function touch;
+
+class ClearPathCacheCest
+{
+    /**
+     * Tests Phalcon\Mvc\View :: clearPathCache()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcViewClearPathCache(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\View - clearPathCache()');
+
+        $first     = outputDir('view-paths/first/');
+        $second    = outputDir('view-paths/second/');
+        $cacheFile = outputDir('view-paths/cache.php');
+        $manifest  = outputDir('view-paths/manifest.php');
+
+        foreach ([$first, $second] as $directory) {
+            if (!is_dir($directory)) {
+                mkdir($directory, 0777, true);
+            }
+        }
+
+        $I->safeDeleteFile($cacheFile);
+        file_put_contents($manifest, '<?php return [];');
+        file_put_contents($second . 'partial.phtml', 'second');
+
+        $I->assertSame('second', $this->render($first, $second, $cacheFile, $manifest));
+        $I->seeFileFound($cacheFile);
+
+        $data = require $cacheFile;
+        $I->assertSame([$second . 'partial.phtml'], array_column($data['paths'], 1));
+
+        /**
+         * The resolved path is used even though the first directory has
+         * the view now
+         */
+        file_put_contents($first . 'partial.phtml', 'first');
+
+        $I->assertSame('second', $this->render($first, $second, $cacheFile, $manifest));
+
+        /**
+         * A modified manifest discards the resolved paths
+         */
+        touch($manifest, time() + 10);
+        clearstatcache();
+
+        $I->assertSame('first', $this->render($first, $second, $cacheFile, $manifest));
+
+        /**
+         * A cached view that was deleted falls back to the next directory
+         */
+        $I->safeDeleteFile($first . 'partial.phtml');
+
+        $view = $this->newView($first, $second, $cacheFile, $manifest);
+
+        $I->assertTrue($view->has('partial'));
+        $I->assertSame('second', $view->getPartial('partial'));
+
+        $view->flushPathCache();
+
+        $data = require $cacheFile;
+        $I->assertSame([$second . 'partial.phtml'], array_column($data['paths'], 1));
+
+        $view->clearPathCache();
+
+        $I->dontSeeFileFound($cacheFile);
+
+        $I->safeDeleteFile($second . 'partial.phtml');
+        $I->safeDeleteFile($manifest);
+        $I->safeDeleteFile($cacheFile . '.lock');
+        rmdir($first);
+        rmdir($second);
+    }
+
+    private function newView(
+        string $first,
+        string $second,
+        string $cacheFile,
+        string $manifest
+    ): View {
+        $view = new View(
+            [
+                'pathCacheFile'     => $cacheFile,
+                'pathCacheManifest' => $manifest,
+            ]
+        );
+
+        $view->setDI(new Di());
+        $view->setViewsDir([$first, $second]);
+
+        return $view;
+    }
+
+    private function render(
+        string $first,
+        string $second,
+        string $cacheFile,
+        string $manifest
+    ): string {
+        return $this
+            ->newView($first, $second, $cacheFile, $manifest)
+            ->getPartial('partial')
+        ;
+    }
+}
@@ -0,0 +1,111 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\View\Engine\Volt;
+
+use IntegrationTester;
+use Phalcon\Mvc\View\Engine\Volt\Compiler;
+use Phalcon\Mvc\View\Engine\Volt\Precompiler;
+
+use function clearstatcache;
+use function dataDir;
+use function filemtime;
+use function outputDir;
+use function touch;
+
+class PrecompilerCest
+{
+    /**
+     * Tests Phalcon\Mvc\View\Engine\Volt\Precompiler :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function mvcViewEngineVoltPrecompilerCompile(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\View\Engine\Volt\Precompiler - compile()');
+
+        $directory = dataDir('fixtures/views/templates/');
+        $manifest  = outputDir('volt-manifest.php');
+        $templateA = $directory . 'a.volt';
+        $templateB = $directory . 'b.volt';
+        $templateC = $directory . 'c.volt';
+        $mtimeA    = filemtime($templateA);
+        $mtimeC    = filemtime($templateC);
+
+        $I->safeDeleteFile($manifest);
+
+        $compiler = new Compiler();
+        $compiler->setOptions(
+            [
+                'path'   => outputDir(),
+                'prefix' => 'precompiler',
+            ]
+        );
+
+        $precompiler = new Precompiler($compiler);
+
+        $actual = $precompiler->compile([$directory], $manifest);
+        $I->assertSame([$templateA, $templateB, $templateC], $actual);
+        $I->seeFileFound($manifest);
+
+        /**
+         * c.volt extends b.volt, which extends a.volt
+         */
+        $data = require $manifest;
+        $I->assertSame([], $data['templates'][$templateA]['dependencies']);
+        $I->assertSame(
+            [
+                'tests/_data/fixtures/views/templates/b.volt',
+                'tests/_data/fixtures/views/templates/a.volt',
+            ],
+            $data['templates'][$templateC]['dependencies']
+        );
+
+        foreach ($data['templates'] as $template) {
+            $I->assertFileExists($template['compiled']);
+        }
+
+        /**
+         * Nothing changed
+         */
+        $actual = $precompiler->compile([$directory], $manifest);
+        $I->assertSame([], $actual);
+
+        /**
+         * Only the changed template
+         */
+        touch($templateC, $mtimeC + 10);
+
+        $actual = $precompiler->compile([$directory], $manifest);
+        $I->assertSame([$templateC], $actual);
+
+        /**
+         * Every template depending on the changed one
+         */
+        touch($templateA, $mtimeA + 10);
+
+        $actual = $precompiler->compile([$directory], $manifest);
+        $I->assertSame([$templateA, $templateB, $templateC], $actual);
+
+        touch($templateA, $mtimeA);
+        touch($templateC, $mtimeC);
+        clearstatcache();
+
+        foreach ($data['templates'] as $template) {
+            $I->safeDeleteFile($template['compiled']);
+        }
+
+        $I->safeDeleteFile($manifest);
+    }
+}
@@ -0,0 +1,128 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Session\Adapter\Redis;
+
+use IntegrationTester;
+use Phalcon\Session\Adapter\Redis;
+use Phalcon\Session\Exception;
+use Phalcon\Storage\AdapterFactory;
+use Phalcon\Storage\SerializerFactory;
+
+use function array_merge;
+use function getOptionsRedis;
+use function uniqid;
+
+class LazyWriteLockingCest
+{
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: write() - lazyWrite
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function sessionAdapterRedisWriteLazyWrite(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - write() - lazyWrite');
+
+        $adapter = $this->newAdapter(['lazyWrite' => true]);
+        $value   = uniqid();
+
+        $I->assertTrue($adapter->write('lazy1', $value));
+        $I->assertSame($value, $adapter->read('lazy1'));
+
+        /**
+         * Unchanged data only has its expiration refreshed
+         */
+        $I->sendCommandToRedis('set', 'sess-reds-lazy1', 'external');
+
+        $I->assertTrue($adapter->write('lazy1', $value));
+        $I->assertSame('external', $I->grabFromRedis('sess-reds-lazy1'));
+
+        $I->assertTrue($adapter->write('lazy1', 'changed'));
+        $I->assertSame('changed', $adapter->read('lazy1'));
+
+        $adapter->close();
+        $I->sendCommandToRedis('del', 'sess-reds-lazy1');
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: read() - locking
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function sessionAdapterRedisReadLocking(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - read() - locking');
+
+        $first  = $this->newAdapter(['locking' => true]);
+        $second = $this->newAdapter(['locking' => true, 'lockWait' => 0]);
+        $value  = uniqid();
+
+        $first->read('lock1');
+        $first->write('lock1', $value);
+
+        $I->seeInRedis('sess-reds-lock1.lock');
+
+        $I->expectThrowable(
+            new Exception('The session [lock1] could not be locked'),
+            function () use ($second) {
+                $second->read('lock1');
+            }
+        );
+
+        $first->close();
+
+        $I->dontSeeInRedis('sess-reds-lock1.lock');
+        $I->assertSame($value, $second->read('lock1'));
+
+        $second->destroy('lock1');
+
+        $I->dontSeeInRedis('sess-reds-lock1.lock');
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: close() - lock taken over
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function sessionAdapterRedisCloseLockTakenOver(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - close() - lock taken over');
+
+        $adapter = $this->newAdapter(['locking' => true]);
+
+        $adapter->read('lock2');
+
+        /**
+         * The lock expired and another request acquired it
+         */
+        $I->sendCommandToRedis('set', 'sess-reds-lock2.lock', 'other');
+
+        $adapter->close();
+
+        $I->assertSame('other', $I->grabFromRedis('sess-reds-lock2.lock'));
+
+        $I->sendCommandToRedis('del', 'sess-reds-lock2.lock');
+    }
+
+    private function newAdapter(array $options): Redis
+    {
+        return new Redis(
+            new AdapterFactory(new SerializerFactory()),
+            array_merge(getOptionsRedis(), $options)
+        );
+    }
+}
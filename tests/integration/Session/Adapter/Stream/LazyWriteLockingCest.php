@@ -0,0 +1,111 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Session\Adapter\Stream;
+
+use IntegrationTester;
+use Phalcon\Session\Adapter\Stream;
+
+use function array_merge;
+use function cacheDir;
+use function fclose;
+use function file_get_contents;
+use function file_put_contents;
+use function flock;
+use function fopen;
+use function getOptionsSessionStream;
+use function uniqid;
+
+use const LOCK_EX;
+use const LOCK_NB;
+use const LOCK_UN;
+
+class LazyWriteLockingCest
+{
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: write() - lazyWrite
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function sessionAdapterStreamWriteLazyWrite(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - write() - lazyWrite');
+
+        $adapter = new Stream(
+            array_merge(getOptionsSessionStream(), ['lazyWrite' => true])
+        );
+        $file    = cacheDir('sessions/lazy1');
+        $value   = uniqid();
+
+        $I->assertTrue($adapter->write('lazy1', $value));
+        $I->assertSame($value, $adapter->read('lazy1'));
+
+        /**
+         * Unchanged data is not written again
+         */
+        file_put_contents($file, 'external');
+
+        $I->assertTrue($adapter->write('lazy1', $value));
+        $I->assertSame('external', file_get_contents($file));
+
+        $I->assertTrue($adapter->write('lazy1', 'changed'));
+        $I->assertSame('changed', file_get_contents($file));
+
+        $adapter->close();
+        $I->safeDeleteFile($file);
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: read() - locking
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function sessionAdapterStreamReadLocking(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - read() - locking');
+
+        $adapter = new Stream(
+            array_merge(getOptionsSessionStream(), ['locking' => true])
+        );
+        $file    = cacheDir('sessions/lock1');
+        $value   = uniqid();
+
+        $I->safeDeleteFile($file);
+
+        /**
+         * A session without a file is neither locked nor created
+         */
+        $I->assertSame('', $adapter->read('lock1'));
+        $I->dontSeeFileFound($file);
+
+        $I->assertTrue($adapter->write('lock1', $value));
+        $I->assertSame($value, $adapter->read('lock1'));
+
+        /**
+         * Other requests cannot lock the session until it is closed
+         */
+        $pointer = fopen($file, 'r');
+        $I->assertFalse(flock($pointer, LOCK_EX | LOCK_NB));
+
+        $adapter->close();
+
+        $I->assertTrue(flock($pointer, LOCK_EX | LOCK_NB));
+        flock($pointer, LOCK_UN);
+        fclose($pointer);
+
+        $I->assertSame($value, file_get_contents($file));
+        $I->safeDeleteFile($file);
+    }
+}
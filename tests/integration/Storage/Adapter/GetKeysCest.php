@@ -28,10 +28,13 @@ use Phalcon\Support\Exception;
 use Phalcon\Support\Exception as HelperException;
 
 use function getOptionsLibmemcached;
+use function file_put_contents;
 use function getOptionsRedis;
 use function outputDir;
 use function phpversion;
+use function sort;
 use function uniqid;
+use function unlink;
 use function version_compare;
 
 class GetKeysCest
@@ -229,6 +232,90 @@ class GetKeysCest
         $I->safeDeleteDirectory(outputDir('ph-strm'));
     }
 
+    /**
+     * Tests Phalcon\Storage\Adapter\Stream :: getKeys() - index
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function storageAdapterStreamGetKeysIndex(IntegrationTester $I)
+    {
+        $I->wantToTest('Storage\Adapter\Stream - getKeys() - index');
+
+        $serializer = new SerializerFactory();
+        $adapter    = new Stream(
+            $serializer,
+            [
+                'storageDir' => outputDir(),
+                'prefix'     => 'index-',
+                'index'      => true,
+            ]
+        );
+
+        $I->assertTrue($adapter->clear());
+
+        $adapter->set('key-1', 'test');
+        $adapter->set('key-2', 'test');
+        $adapter->set('key-2', 'again');
+        $adapter->setForever('one-1', 'test');
+        $adapter->set('123', 'test');
+        $adapter->set("line\nbreak\\n", 'test');
+
+        $I->assertTrue($adapter->delete('key-1'));
+
+        $I->seeFileFound(outputDir('index-/.index'));
+
+        /**
+         * Line breaks in keys are escaped in the index
+         */
+        $expected = [
+            'index-123',
+            'index-key-2',
+            "index-line\nbreak\\n",
+            'index-one-1',
+        ];
+        $actual   = $adapter->getKeys();
+        sort($actual);
+        $I->assertSame($expected, $actual);
+
+        $expected = [
+            'index-one-1',
+        ];
+        $I->assertSame($expected, $adapter->getKeys('one'));
+
+        /**
+         * Without the index, the index file and the files set() is still
+         * writing are not listed
+         */
+        $temporary = outputDir('index-/key-3.0123456789abcd.12345678.tmp');
+        file_put_contents($temporary, 'partial');
+
+        $plain  = new Stream(
+            $serializer,
+            [
+                'storageDir' => outputDir(),
+                'prefix'     => 'index-',
+            ]
+        );
+        $actual = $plain->getKeys();
+        $I->assertContains('index-one-1', $actual);
+        $I->assertNotContains('index-.index', $actual);
+        $I->assertNotContains('index-key-3.0123456789abcd.12345678.tmp', $actual);
+
+        unlink($temporary);
+
+        /**
+         * Only the indexed items are cleared
+         */
+        $I->assertTrue($adapter->clear());
+        $I->assertSame([], $adapter->getKeys());
+        $I->assertFalse($adapter->has('key-2'));
+        $I->assertFalse($adapter->has('one-1'));
+        $I->assertFalse($adapter->has("line\nbreak\\n"));
+
+        $I->safeDeleteDirectory(outputDir('index-'));
+    }
+
     /**
      * Tests Phalcon\Storage\Adapter\Stream :: getKeys()
      *
@@ -26,10 +26,14 @@ use Phalcon\Storage\Exception as StorageException;
 use Phalcon\Storage\SerializerFactory;
 use Phalcon\Support\Exception as HelperException;
 
+use function file_get_contents;
+use function file_put_contents;
 use function getOptionsLibmemcached;
 use function getOptionsRedis;
 use function outputDir;
 use function sprintf;
+use function str_repeat;
+use function substr;
 use function uniqid;
 
 class HasCest
@@ -96,7 +100,7 @@ class HasCest
                 ],
             ],
             [
-                'phpFileGetContents' => false,
+                'phpFread' => false,
             ]
         );
 
@@ -108,6 +112,38 @@ class HasCest
         $I->assertFalse($actual);
     }
 
+    /**
+     * Tests Phalcon\Storage\Adapter\Stream :: has() - truncated file
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function storageAdapterStreamHasTruncated(IntegrationTester $I)
+    {
+        $I->wantToTest('Storage\Adapter\Stream - has() - truncated file');
+
+        $adapter = new Stream(
+            new SerializerFactory(),
+            [
+                'storageDir' => outputDir(),
+            ]
+        );
+
+        $key = 'tr';
+        $I->assertTrue($adapter->set($key, str_repeat('a', 100)));
+        $I->assertTrue($adapter->has($key));
+
+        $filepath = outputDir('ph-strm/t/tr');
+        $I->seeFileFound($filepath);
+
+        $content = file_get_contents($filepath);
+        file_put_contents($filepath, substr($content, 0, -10));
+
+        $I->assertFalse($adapter->has($key));
+
+        $I->safeDeleteFile($filepath);
+    }
+
     /**
      * Tests Phalcon\Storage\Adapter\* :: has()
      *
@@ -0,0 +1,172 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Acl\Adapter\Memory;
+
+use Phalcon\Acl\Adapter\Memory;
+use Phalcon\Acl\Enum;
+use Phalcon\Acl\Exception;
+use UnitTester;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function aclAdapterMemoryCompile(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - compile()');
+
+        $acl      = $this->newAcl();
+        $expected = $this->getDecisions($acl);
+
+        $acl->compile();
+
+        $I->assertSame($expected, $this->getDecisions($acl));
+
+        /**
+         * Modifying the ACL discards the matrix
+         */
+        $acl->deny('editors', 'posts', 'delete');
+
+        $I->assertFalse($acl->isAllowed('editors', 'posts', 'delete'));
+
+        $acl->compile();
+
+        $I->assertTrue($acl->isAllowed('admins', 'posts', 'delete'));
+        $I->assertSame('admins!*!*', $acl->getActiveKey());
+        $I->assertFalse($acl->isAllowed('editors', 'posts', 'delete'));
+        $I->assertSame('editors!posts!delete', $acl->getActiveKey());
+    }
+
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: loadCompiled()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function aclAdapterMemoryLoadCompiled(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - loadCompiled()');
+
+        $acl      = $this->newAcl();
+        $expected = $this->getDecisions($acl);
+        $compiled = $acl->compile();
+
+        $acl = new Memory();
+        $acl->loadCompiled($compiled);
+
+        $I->assertSame(Enum::DENY, $acl->getDefaultAction());
+        $I->assertSame($expected, $this->getDecisions($acl));
+
+        $acl->isAllowed('editors', 'posts', 'index');
+        $I->assertSame('editors!posts!*', $acl->getActiveKey());
+
+        $I->expectThrowable(
+            new Exception('The compiled ACL is not valid'),
+            function () use ($acl) {
+                $acl->loadCompiled('invalid');
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: loadCompiled() - function
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function aclAdapterMemoryLoadCompiledFunction(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - loadCompiled() - function');
+
+        $acl = new Memory();
+        $acl->addRole('guests');
+        $acl->addComponent('posts', ['index']);
+        $acl->allow(
+            'guests',
+            'posts',
+            'index',
+            function ($allowed) {
+                return $allowed;
+            }
+        );
+
+        $compiled = $acl->compile();
+
+        $I->assertTrue($acl->isAllowed('guests', 'posts', 'index', ['allowed' => true]));
+        $I->assertFalse($acl->isAllowed('guests', 'posts', 'index', ['allowed' => false]));
+
+        $acl = new Memory();
+        $acl->loadCompiled($compiled);
+
+        $I->expectThrowable(
+            new Exception(
+                "The function of the compiled rule 'guests!posts!index' is not defined in the ACL"
+            ),
+            function () use ($acl) {
+                $acl->isAllowed('guests', 'posts', 'index', ['allowed' => true]);
+            }
+        );
+    }
+
+    private function getDecisions(Memory $acl): array
+    {
+        $decisions = [];
+        $roles     = ['guests', 'editors', 'admins', 'unknown'];
+        $accesses  = [
+            'posts'    => ['index', 'edit', 'delete', 'unknown', '*'],
+            'comments' => ['index', 'edit', 'unknown', '*'],
+            'reports'  => ['view', 'unknown', '*'],
+            'unknown'  => ['index', '*'],
+            '*'        => ['index', '*'],
+        ];
+
+        foreach ($roles as $role) {
+            foreach ($accesses as $component => $names) {
+                foreach ($names as $name) {
+                    $decisions[$role . '!' . $component . '!' . $name] =
+                        $acl->isAllowed($role, $component, $name);
+                }
+            }
+        }
+
+        return $decisions;
+    }
+
+    private function newAcl(): Memory
+    {
+        $acl = new Memory();
+        $acl->setDefaultAction(Enum::DENY);
+
+        $acl->addRole('guests');
+        $acl->addRole('editors', 'guests');
+        $acl->addRole('admins', 'editors');
+
+        $acl->addComponent('posts', ['index', 'edit', 'delete']);
+        $acl->addComponent('comments', ['index', 'edit']);
+        $acl->addComponent('reports', ['view']);
+
+        $acl->allow('guests', 'posts', 'index');
+        $acl->allow('guests', 'comments', 'index');
+        $acl->allow('editors', 'posts', '*');
+        $acl->deny('editors', 'comments', 'edit');
+        $acl->allow('admins', '*', '*');
+        $acl->deny('admins', 'reports', 'view');
+
+        return $acl;
+    }
+}
@@ -0,0 +1,108 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Annotations\Adapter\Compiled;
+
+use Phalcon\Annotations\Adapter\Compiled;
+use Phalcon\Annotations\Collection;
+use Phalcon\Annotations\Reflection;
+use TestClass;
+use UnitTester;
+
+use function clearstatcache;
+use function dataDir;
+use function filemtime;
+use function outputDir;
+use function touch;
+
+class ReadWriteCest
+{
+    /**
+     * Tests Phalcon\Annotations\Adapter\Compiled :: read() / write()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function annotationsAdapterCompiledReadWrite(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Adapter\Compiled - read() / write()');
+
+        $classFile = dataDir('fixtures/Annotations/TestClass.php');
+        $compiled  = outputDir('tests/annotations/testclass.php');
+        $mtime     = filemtime($classFile);
+
+        require_once $classFile;
+
+        $I->safeDeleteFile($compiled);
+
+        $adapter = new Compiled(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        $I->assertFalse($adapter->read(TestClass::class));
+
+        $reflection = $adapter->get(TestClass::class);
+        $I->assertFileExists($compiled);
+
+        $data = require $compiled;
+        $I->assertSame($classFile, $data['file']);
+        $I->assertSame($mtime, $data['mtime']);
+
+        /**
+         * The next request reads the compiled file
+         */
+        $adapter = new Compiled(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        $actual = $adapter->read(TestClass::class);
+        $I->assertInstanceOf(Reflection::class, $actual);
+        $I->assertSame(
+            $reflection->getReflectionData(),
+            $actual->getReflectionData()
+        );
+
+        $method = $adapter->getMethod(TestClass::class, 'TESTMETHOD1');
+        $I->assertInstanceOf(Collection::class, $method);
+        $I->assertTrue($method->has('NamedMultipleParams'));
+
+        /**
+         * A changed class file outdates the compiled annotations
+         */
+        touch($classFile, $mtime + 10);
+        clearstatcache();
+
+        $I->assertFalse($adapter->read(TestClass::class));
+
+        $adapter = new Compiled(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+                'stat'           => false,
+            ]
+        );
+
+        $I->assertInstanceOf(
+            Reflection::class,
+            $adapter->read(TestClass::class)
+        );
+
+        touch($classFile, $mtime);
+        clearstatcache();
+
+        $I->safeDeleteFile($compiled);
+    }
+}
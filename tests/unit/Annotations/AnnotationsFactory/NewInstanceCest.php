@@ -15,6 +15,7 @@ namespace Phalcon\Tests\Unit\Annotations\AnnotationsFactory;
 
 use Codeception\Example;
 use Phalcon\Annotations\Adapter\Apcu;
+use Phalcon\Annotations\Adapter\Compiled;
 use Phalcon\Annotations\Adapter\Memory;
 use Phalcon\Annotations\Adapter\Stream;
 use Phalcon\Annotations\AnnotationsFactory;
@@ -50,6 +51,10 @@ class NewInstanceCest
                 'apcu',
                 Apcu::class,
             ],
+            [
+                'compiled',
+                Compiled::class,
+            ],
             [
                 'memory',
                 Memory::class,
@@ -0,0 +1,75 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Annotations\Reflection;
+
+use Phalcon\Annotations\Collection;
+use Phalcon\Annotations\Reader;
+use Phalcon\Annotations\Reflection;
+use UnitTester;
+
+use function array_keys;
+use function dataDir;
+
+class GetMethodAnnotationsCest
+{
+    /**
+     * executed before each test
+     */
+    protected function _before(UnitTester $I)
+    {
+        require_once dataDir('fixtures/Annotations/TestClass.php');
+    }
+
+    /**
+     * Tests Phalcon\Annotations\Reflection :: getMethodAnnotations()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function annotationsReflectionGetMethodAnnotations(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Reflection - getMethodAnnotations()');
+
+        $reader     = new Reader();
+        $reflection = new Reflection(
+            $reader->parse('TestClass')
+        );
+
+        $I->assertNull($reflection->getMethodAnnotations('unknownMethod'));
+
+        $method = $reflection->getMethodAnnotations('testMethod3');
+        $I->assertInstanceOf(Collection::class, $method);
+        $I->assertSame($method, $reflection->getMethodAnnotations('TESTMETHOD3'));
+
+        /**
+         * The collection is reused and the methods keep their order
+         */
+        $methods = $reflection->getMethodsAnnotations();
+        $I->assertSame($method, $methods['testMethod3']);
+        $I->assertSame(
+            [
+                'testMethod1',
+                'testMethod3',
+                'testMethod4',
+                'testMethod5',
+            ],
+            array_keys($methods)
+        );
+        $I->assertSame($methods, $reflection->getMethodsAnnotations());
+
+        $property = $reflection->getPropertyAnnotations('testProp1');
+        $I->assertInstanceOf(Collection::class, $property);
+        $I->assertNull($reflection->getPropertyAnnotations('unknownProp'));
+    }
+}
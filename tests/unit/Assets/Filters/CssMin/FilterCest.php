@@ -13,9 +13,12 @@ declare(strict_types=1);
 
 namespace Phalcon\Tests\Unit\Assets\Filters\CssMin;
 
+use Phalcon\Assets\Exception;
 use Phalcon\Assets\Filters\CssMin;
 use UnitTester;
 
+use function dataDir;
+
 /**
  * Class FilterCest
  *
@@ -41,4 +44,47 @@ class FilterCest
         $actual   = $cssmin->filter('{}}');
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Assets\Filters\CssMin :: filter() - fixture
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function assetsFiltersCssMinFilterFixture(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Filters\CssMin - filter() - fixture');
+
+        $cssmin = new Cssmin();
+
+        $expected = file_get_contents(
+            dataDir('assets/assets/cssmin-01-result.css')
+        );
+        $actual   = $cssmin->filter(
+            file_get_contents(dataDir('assets/assets/cssmin-01.css'))
+        );
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Assets\Filters\CssMin :: filter() - exception
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function assetsFiltersCssMinFilterException(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Filters\CssMin - filter() - exception');
+
+        $I->expectThrowable(
+            new Exception('Unterminated comment.'),
+            function () {
+                (new Cssmin())->filter("a { color: red; } /* unterminated");
+            }
+        );
+    }
 }
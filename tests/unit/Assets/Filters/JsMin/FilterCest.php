@@ -13,9 +13,12 @@ declare(strict_types=1);
 
 namespace Phalcon\Tests\Unit\Assets\Filters\JsMin;
 
+use Phalcon\Assets\Exception;
 use Phalcon\Assets\Filters\JsMin;
 use UnitTester;
 
+use function dataDir;
+
 class FilterCest
 {
     /**
@@ -36,4 +39,47 @@ class FilterCest
         $actual   = $jsmin->filter('{}}');
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Assets\Filters\JsMin :: filter() - fixture
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function assetsFiltersJsMinFilterFixture(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Filters\JsMin - filter() - fixture');
+
+        $jsmin = new JsMin();
+
+        $expected = file_get_contents(
+            dataDir('assets/assets/jsmin-01-result.js')
+        );
+        $actual   = $jsmin->filter(
+            file_get_contents(dataDir('assets/assets/jsmin-01.js'))
+        );
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Assets\Filters\JsMin :: filter() - exception
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function assetsFiltersJsMinFilterException(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Filters\JsMin - filter() - exception');
+
+        $I->expectThrowable(
+            new Exception('Unterminated string literal.'),
+            function () {
+                (new JsMin())->filter("var a = 'unterminated;");
+            }
+        );
+    }
 }
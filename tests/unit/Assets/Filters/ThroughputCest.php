@@ -0,0 +1,118 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Assets\Filters;
+
+use Codeception\Example;
+use Phalcon\Assets\FilterInterface;
+use Phalcon\Assets\Filters\CssMin;
+use Phalcon\Assets\Filters\JsMin;
+use UnitTester;
+
+use function codecept_debug;
+use function dataDir;
+use function file_get_contents;
+use function glob;
+use function hrtime;
+use function sprintf;
+use function str_repeat;
+use function strlen;
+
+class ThroughputCest
+{
+    /**
+     * Size of the content minified by each benchmark
+     */
+    private const SIZE = 4194304;
+
+    /**
+     * Tests Phalcon\Assets\Filters :: filter() - throughput
+     *
+     * Minifies the fixtures in tests/_data/assets, repeated up to 4MB, and
+     * reports the throughput in MB/s. Run with --debug to see the figures.
+     *
+     * @dataProvider getExamples
+     *
+     * @param UnitTester $I
+     * @param Example    $example
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function assetsFiltersThroughput(UnitTester $I, Example $example)
+    {
+        $I->wantToTest(
+            'Assets\Filters - filter() - throughput - ' . $example['label']
+        );
+
+        /** @var FilterInterface $filter */
+        $filter = $example['filter'];
+        $total  = 0;
+        $input  = 0;
+        $output = 0;
+
+        foreach (glob(dataDir('assets/assets/*.' . $example['extension'])) as $file) {
+            $content = file_get_contents($file);
+            if ('' === $content) {
+                continue;
+            }
+
+            /**
+             * A newline keeps the repeated copies apart
+             */
+            $content = str_repeat(
+                $content . "\n",
+                (int) (self::SIZE / (strlen($content) + 1)) + 1
+            );
+
+            $start    = hrtime(true);
+            $minified = $filter->filter($content);
+            $total    += hrtime(true) - $start;
+            $input    += strlen($content);
+            $output   += strlen($minified);
+
+            $I->assertLessOrEquals(strlen($content), strlen($minified));
+        }
+
+        $I->assertGreaterThan(0, $input);
+
+        codecept_debug(
+            sprintf(
+                '%s: %.2f MB in, %.2f MB out, %.2f MB/s',
+                $example['label'],
+                $input / 1048576,
+                $output / 1048576,
+                ($input / 1048576) / max($total / 1e9, 1e-9)
+            )
+        );
+    }
+
+    /**
+     * @return array[]
+     */
+    private function getExamples(): array
+    {
+        return [
+            [
+                'label'     => 'JsMin',
+                'filter'    => new JsMin(),
+                'extension' => 'js',
+            ],
+            [
+                'label'     => 'CssMin',
+                'filter'    => new CssMin(),
+                'extension' => 'css',
+            ],
+        ];
+    }
+}
@@ -0,0 +1,156 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Autoload\Loader;
+
+use Phalcon\Autoload\Loader;
+use Phalcon\Tests\Fixtures\Traits\LoaderTrait;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+
+class ClassMapCest
+{
+    use LoaderTrait;
+
+    /**
+     * Tests Phalcon\Autoload\Loader :: buildClassMap()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function autoloaderLoaderBuildClassMap(UnitTester $I)
+    {
+        $I->wantToTest('Autoload\Loader - buildClassMap()');
+
+        $loader = new Loader();
+        $loader
+            ->setExtensions(['inc'])
+            ->addNamespace(
+                'Example\Namespaces\Engines',
+                dataDir('fixtures/Loader/Example/Namespaces/Engines/')
+            )
+        ;
+
+        $directory = dataDir('fixtures/Loader/Example/Namespaces/Engines/');
+        $expected  = [
+            'Example\Namespaces\Engines\Alcohol'  => $directory . 'Alcohol.inc',
+            'Example\Namespaces\Engines\Diesel'   => $directory . 'Diesel.php',
+            'Example\Namespaces\Engines\Gasoline' => $directory . 'Gasoline.php',
+        ];
+        $actual    = $loader->buildClassMap();
+        ksort($actual);
+        $I->assertSame($expected, $actual);
+        $I->assertNull($loader->getClassMap());
+    }
+
+    /**
+     * Tests Phalcon\Autoload\Loader :: loadClassMap() - authoritative
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function autoloaderLoaderLoadClassMapAuthoritative(UnitTester $I)
+    {
+        $I->wantToTest('Autoload\Loader - loadClassMap() - authoritative');
+
+        $file      = outputDir('classmap.php');
+        $directory = dataDir('fixtures/Loader/Example/Namespaces/Engines/');
+        $I->safeDeleteFile($file);
+
+        /**
+         * The file is built on first use
+         */
+        $loader = new Loader();
+        $loader
+            ->addNamespace('Example\Namespaces\Engines', $directory)
+            ->loadClassMap($file)
+        ;
+
+        $I->seeFileFound($file);
+        $I->assertSame($loader->getClassMap(), require $file);
+
+        /**
+         * Without namespaces the classes are only found in the map
+         */
+        $loader = new Loader(true);
+        $loader->loadClassMap($file, true);
+
+        $I->assertTrue(
+            $loader->autoload('Example\Namespaces\Engines\Diesel')
+        );
+
+        $expected = [
+            'Loading: Example\Namespaces\Engines\Diesel',
+            'Class: 404: Example\Namespaces\Engines\Diesel',
+            'Class map: load: ' . $directory . 'Diesel.php',
+        ];
+        $I->assertSame($expected, $loader->getDebug());
+
+        $I->assertFalse(
+            $loader->autoload('Example\Namespaces\Engines\Alcohol')
+        );
+
+        $expected = [
+            'Loading: Example\Namespaces\Engines\Alcohol',
+            'Class: 404: Example\Namespaces\Engines\Alcohol',
+            'Class map: 404: Example\Namespaces\Engines\Alcohol',
+        ];
+        $I->assertSame($expected, $loader->getDebug());
+
+        $I->safeDeleteFile($file);
+    }
+
+    /**
+     * Tests Phalcon\Autoload\Loader :: loadClassMap() - fallback
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function autoloaderLoaderLoadClassMapFallback(UnitTester $I)
+    {
+        $I->wantToTest('Autoload\Loader - loadClassMap() - fallback');
+
+        $file      = outputDir('classmap.php');
+        $directory = dataDir('fixtures/Loader/Example/Namespaces/Engines/');
+        $I->safeDeleteFile($file);
+
+        $loader = new Loader(true);
+        $loader->addNamespace('Example\Namespaces\Engines', $directory);
+        $loader->dumpClassMap($file);
+
+        /**
+         * Classes added after the map was built are still searched for
+         */
+        $loader->addExtension('inc');
+        $loader->loadClassMap($file);
+
+        $I->assertTrue(
+            $loader->autoload('Example\Namespaces\Engines\Alcohol')
+        );
+
+        $expected = [
+            'Loading: Example\Namespaces\Engines\Alcohol',
+            'Class: 404: Example\Namespaces\Engines\Alcohol',
+            'Class map: 404: Example\Namespaces\Engines\Alcohol',
+            'Require: 404: ' . $directory . 'Alcohol.php',
+            'Require: ' . $directory . 'Alcohol.inc',
+            'Namespace: Example\Namespaces\Engines\ - ' .
+            $directory . 'Alcohol.inc',
+        ];
+        $I->assertSame($expected, $loader->getDebug());
+
+        $I->safeDeleteFile($file);
+    }
+}
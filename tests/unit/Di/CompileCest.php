@@ -0,0 +1,191 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Di;
+
+use Phalcon\Di\Di;
+use Phalcon\Di\Exception;
+use Phalcon\Di\Service;
+use Phalcon\Events\Manager;
+use Phalcon\Html\Escaper;
+use Phalcon\Tests\Fixtures\Di\InjectionAwareComponent;
+use Phalcon\Tests\Fixtures\Di\PropertiesComponent;
+use Phalcon\Tests\Fixtures\Di\ServiceComponent;
+use stdClass;
+use UnitTester;
+
+use function outputDir;
+
+class CompileCest
+{
+    /**
+     * Unit Tests Phalcon\Di :: compile()/loadCompiled()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function diCompileLoadCompiled(UnitTester $I)
+    {
+        $I->wantToTest('Di - compile()/loadCompiled()');
+
+        $file = outputDir('compiled-container.php');
+        $I->safeDeleteFile($file);
+
+        $container = new Di();
+        $container->setShared('escaper', Escaper::class);
+        $container->set('aware', InjectionAwareComponent::class);
+        $container->set(
+            'component',
+            [
+                'className'  => PropertiesComponent::class,
+                'arguments'  => [
+                    [
+                        'type'  => 'parameter',
+                        'value' => 'phalcon',
+                    ],
+                    [
+                        'type'  => 'parameter',
+                        'value' => 1,
+                    ],
+                    [
+                        'type' => 'service',
+                        'name' => 'escaper',
+                    ],
+                ],
+                'calls'      => [
+                    [
+                        'method'    => 'transform',
+                        'arguments' => [
+                            [
+                                'type'  => 'parameter',
+                                'value' => 2,
+                            ],
+                        ],
+                    ],
+                ],
+                'properties' => [
+                    [
+                        'name'  => 'propertyName',
+                        'value' => [
+                            'type'  => 'parameter',
+                            'value' => 'property',
+                        ],
+                    ],
+                ],
+            ]
+        );
+        $container->set(
+            'closure',
+            function () {
+                return new stdClass();
+            }
+        );
+
+        $container->compile($file, 'Phalcon\Tests\Compiled\UnitContainer');
+
+        $I->seeFileFound($file);
+
+        /**
+         * Closures are not compiled
+         */
+        $container = new Di();
+        $container->loadCompiled($file, 'Phalcon\Tests\Compiled\UnitContainer');
+
+        $I->assertSame(
+            [
+                'escaper'   => true,
+                'aware'     => false,
+                'component' => false,
+            ],
+            \Phalcon\Tests\Compiled\UnitContainer::SERVICES
+        );
+        $I->assertTrue($container->has('component'));
+        $I->assertFalse($container->has('closure'));
+
+        $escaper = $container->get('escaper');
+        $I->assertInstanceOf(Escaper::class, $escaper);
+        $I->assertSame($escaper, $container->get('escaper'));
+
+        $aware = $container->get('aware');
+        $I->assertInstanceOf(InjectionAwareComponent::class, $aware);
+        $I->assertSame($container, $aware->getDI());
+        $I->assertNotSame($aware, $container->get('aware'));
+
+        $component = $container->get('component');
+        $I->assertInstanceOf(PropertiesComponent::class, $component);
+        $I->assertSame('phalcon', $component->getName());
+        $I->assertSame(2, $component->getType());
+        $I->assertSame('property', $component->propertyName);
+        $I->assertSame($escaper, $component->getEscaper());
+
+        /**
+         * Parameters override the compiled definition
+         */
+        $component = $container->get('component', ['override', 5]);
+        $I->assertSame('override', $component->getName());
+        $I->assertSame(5, $component->getType());
+        $I->assertInstanceOf(Service::class, $container->getService('component'));
+
+        /**
+         * Services registered afterwards replace the compiled ones
+         */
+        $container->set('aware', ServiceComponent::class);
+        $I->assertSame(
+            ServiceComponent::class,
+            $container->getRaw('aware')
+        );
+        $I->assertCount(3, $container->getServices());
+
+        /**
+         * Services registered before keep precedence over the compiled ones
+         */
+        $container = new Di();
+        $container->set('aware', ServiceComponent::class);
+        $container->loadCompiled($file, 'Phalcon\Tests\Compiled\UnitContainer');
+
+        $I->assertInstanceOf(ServiceComponent::class, $container->get('aware'));
+        $I->assertSame(ServiceComponent::class, $container->getRaw('aware'));
+        $I->assertInstanceOf(ServiceComponent::class, $container->get('aware'));
+
+        /**
+         * Instances returned by the di:beforeServiceResolve event get the
+         * container
+         */
+        $manager = new Manager();
+        $manager->attach(
+            'di:beforeServiceResolve',
+            function () {
+                return new InjectionAwareComponent();
+            }
+        );
+
+        $container = new Di();
+        $container->loadCompiled($file, 'Phalcon\Tests\Compiled\UnitContainer');
+        $container->setInternalEventsManager($manager);
+
+        $aware = $container->get('component');
+        $I->assertInstanceOf(InjectionAwareComponent::class, $aware);
+        $I->assertSame($container, $aware->getDI());
+
+        $I->safeDeleteFile($file);
+
+        $I->expectThrowable(
+            new Exception(
+                "The compiled container '" . $file . "' was not found"
+            ),
+            function () use ($file) {
+                (new Di())->loadCompiled($file, 'Phalcon\Tests\Compiled\Missing');
+            }
+        );
+    }
+}
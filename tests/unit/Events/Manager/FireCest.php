@@ -96,6 +96,61 @@ class FireCest
         $I->assertSame($expected, $actual);
     }
 
+    /**
+     * Tests Phalcon\Events\Manager :: fire() - attach and detach between fires
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function eventsManagerFireAttachDetach(UnitTester $I)
+    {
+        $I->wantToTest('Events\Manager - fire() - attach and detach between fires');
+
+        $manager = new Manager();
+        $one     = new OneListener();
+        $two     = new TwoListener();
+        $three   = new ThreeListener();
+
+        $manager->enablePriorities(true);
+        $manager->collectResponses(true);
+
+        $manager->attach('ab', $three, 10);
+
+        $component = new ComponentOne();
+        $component->setEventsManager($manager);
+
+        $component->doAction();
+        $I->assertSame(['three'], $manager->getResponses());
+
+        /**
+         * The sorted listeners are rebuilt after attach() and detach()
+         */
+        $manager->attach('ab:beforeAction', $one, 30);
+        $manager->attach('ab', $two, 20);
+
+        $component->doAction();
+        $I->assertSame(['two', 'three', 'one'], $manager->getResponses());
+        $I->assertSame([$two, $three], $manager->getListeners('ab'));
+
+        $manager->detach('ab', $three);
+
+        $component->doAction();
+        $I->assertSame(['two', 'one'], $manager->getResponses());
+
+        $manager->detachAll('ab:beforeAction');
+
+        $component->doAction();
+        $I->assertSame(['two'], $manager->getResponses());
+
+        /**
+         * Listeners without a method for the event are skipped
+         */
+        $I->assertNull($manager->fire('ab:afterAction', $component));
+        $I->assertSame([], $manager->getResponses());
+
+        $I->assertNull($manager->fire('cd:beforeAction', $component));
+    }
+
     /**
      * Tests Phalcon\Events\Manager :: fire() - no events
      *
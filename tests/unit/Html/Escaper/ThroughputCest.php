@@ -0,0 +1,144 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Html\Escaper;
+
+use Codeception\Example;
+use Phalcon\Html\Escaper;
+use UnitTester;
+
+use function codecept_debug;
+use function hrtime;
+use function htmlspecialchars;
+use function json_encode;
+use function mb_convert_encoding;
+use function rawurlencode;
+use function sprintf;
+use function str_repeat;
+use function strlen;
+
+use const ENT_HTML401;
+use const ENT_QUOTES;
+use const ENT_SUBSTITUTE;
+use const JSON_UNESCAPED_UNICODE;
+
+class ThroughputCest
+{
+    /**
+     * Size of the content escaped by each benchmark
+     */
+    private const SIZE = 1048576;
+
+    /**
+     * Tests Phalcon\Html\Escaper - throughput
+     *
+     * Escapes a JSON document and plain text, repeated up to 1MB, and
+     * reports the throughput of the native UTF-8 escaper next to the
+     * previous path. CSS and JS compare against the ISO-8859-1 copy of the
+     * content, which is still converted to UTF-32 first. Run with --debug
+     * to see the figures.
+     *
+     * @dataProvider getExamples
+     *
+     * @param UnitTester $I
+     * @param Example    $example
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function htmlEscaperThroughput(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Escaper - throughput - ' . $example['method']);
+
+        $escaper = new Escaper();
+        $method  = $example['method'];
+        $samples = [
+            'json' => json_encode(
+                [
+                    'title'   => 'Crème brûlée <b>"à la carte"</b>',
+                    'tags'    => ['dessert', 'français', "chef's choice"],
+                    'price'   => 12.5,
+                    'summary' => 'Vanilla & caramel, served cold',
+                ],
+                JSON_UNESCAPED_UNICODE
+            ),
+            'text' => 'The quick brown fox had a coffee at the café ',
+        ];
+
+        foreach ($samples as $label => $sample) {
+            $content = str_repeat(
+                $sample,
+                (int) (self::SIZE / strlen($sample)) + 1
+            );
+
+            $start  = hrtime(true);
+            $actual = $escaper->$method($content);
+            $native = hrtime(true) - $start;
+
+            if ('css' === $method || 'js' === $method) {
+                $previous = mb_convert_encoding($content, 'ISO-8859-1', 'UTF-8');
+
+                $start    = hrtime(true);
+                $expected = $escaper->$method($previous);
+                $baseline = hrtime(true) - $start;
+            } elseif ('html' === $method) {
+                $start    = hrtime(true);
+                $expected = htmlspecialchars(
+                    $content,
+                    ENT_QUOTES | ENT_SUBSTITUTE | ENT_HTML401,
+                    'utf-8',
+                    true
+                );
+                $baseline = hrtime(true) - $start;
+            } else {
+                $start    = hrtime(true);
+                $expected = rawurlencode($content);
+                $baseline = hrtime(true) - $start;
+            }
+
+            $I->assertSame($expected, $actual);
+
+            codecept_debug(
+                sprintf(
+                    '%s %s: %.2f MB, native %.2f MB/s, previous %.2f MB/s',
+                    $method,
+                    $label,
+                    strlen($content) / 1048576,
+                    (strlen($content) / 1048576) / max($native / 1e9, 1e-9),
+                    (strlen($content) / 1048576) / max($baseline / 1e9, 1e-9)
+                )
+            );
+        }
+    }
+
+    /**
+     * @return array[]
+     */
+    private function getExamples(): array
+    {
+        return [
+            [
+                'method' => 'css',
+            ],
+            [
+                'method' => 'js',
+            ],
+            [
+                'method' => 'html',
+            ],
+            [
+                'method' => 'url',
+            ],
+        ];
+    }
+}
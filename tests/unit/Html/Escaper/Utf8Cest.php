@@ -0,0 +1,106 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Html\Escaper;
+
+use Codeception\Example;
+use Phalcon\Html\Escaper;
+use UnitTester;
+
+use function htmlspecialchars;
+use function json_encode;
+use function mb_convert_encoding;
+use function rawurlencode;
+
+use const ENT_HTML401;
+use const ENT_QUOTES;
+use const ENT_SUBSTITUTE;
+use const JSON_UNESCAPED_UNICODE;
+
+class Utf8Cest
+{
+    /**
+     * Tests Phalcon\Html\Escaper - UTF-8 content
+     *
+     * The native UTF-8 escaper returns the same output as the previous
+     * path. CSS and JS compare against the ISO-8859-1 copy of the content,
+     * which is still converted to UTF-32 first.
+     *
+     * @dataProvider getExamples
+     *
+     * @param UnitTester $I
+     * @param Example    $example
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function htmlEscaperUtf8(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Escaper - UTF-8 - ' . $example['method']);
+
+        $escaper = new Escaper();
+        $method  = $example['method'];
+        $samples = [
+            json_encode(
+                [
+                    'title'   => 'Crème brûlée <b>"à la carte"</b>',
+                    'tags'    => ['dessert', 'français', "chef's choice"],
+                    'price'   => 12.5,
+                    'summary' => 'Vanilla & caramel, served cold',
+                ],
+                JSON_UNESCAPED_UNICODE
+            ),
+            'The quick brown fox had a coffee at the café ',
+        ];
+
+        foreach ($samples as $content) {
+            if ('css' === $method || 'js' === $method) {
+                $expected = $escaper->$method(
+                    mb_convert_encoding($content, 'ISO-8859-1', 'UTF-8')
+                );
+            } elseif ('html' === $method) {
+                $expected = htmlspecialchars(
+                    $content,
+                    ENT_QUOTES | ENT_SUBSTITUTE | ENT_HTML401,
+                    'utf-8',
+                    true
+                );
+            } else {
+                $expected = rawurlencode($content);
+            }
+
+            $I->assertSame($expected, $escaper->$method($content));
+        }
+    }
+
+    /**
+     * @return array[]
+     */
+    private function getExamples(): array
+    {
+        return [
+            [
+                'method' => 'css',
+            ],
+            [
+                'method' => 'js',
+            ],
+            [
+                'method' => 'html',
+            ],
+            [
+                'method' => 'url',
+            ],
+        ];
+    }
+}
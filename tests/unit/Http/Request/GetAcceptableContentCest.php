@@ -71,4 +71,48 @@ class GetAcceptableContentCest
 
         $_SERVER = $store;
     }
+
+    /**
+     * Tests Phalcon\Http\Request :: getAcceptableContent() - spaces
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function httpRequestGetAcceptableContentSpaces(UnitTester $I)
+    {
+        $I->wantToTest('Http\Request - getAcceptableContent() - spaces');
+
+        $store   = $_SERVER ?? [];
+        $time    = $_SERVER['REQUEST_TIME_FLOAT'];
+        $_SERVER = [
+            'REQUEST_TIME_FLOAT' => $time,
+            'HTTP_ACCEPT'        => 'text/html ;  level=1 , , application/json;q=0.5,',
+        ];
+
+        $request = new Request();
+
+        $expected = [
+            [
+                'accept'  => 'text/html',
+                'quality' => 1.0,
+                'level'   => '1',
+            ],
+            [
+                'accept'  => 'application/json',
+                'quality' => 0.5,
+            ],
+        ];
+
+        $I->assertSame($expected, $request->getAcceptableContent());
+        $I->assertSame('text/html', $request->getBestAccept());
+
+        /**
+         * A new header value is parsed again
+         */
+        $_SERVER['HTTP_ACCEPT'] = 'application/xml;q=0.2, text/plain;q=0.7';
+
+        $I->assertSame('text/plain', $request->getBestAccept());
+
+        $_SERVER = $store;
+    }
 }
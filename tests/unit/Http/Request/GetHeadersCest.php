@@ -50,4 +50,53 @@ class GetHeadersCest
 
         $_SERVER = $store;
     }
+
+    /**
+     * Tests Phalcon\Http\Request :: getHeaders() - server changed
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function httpRequestGetHeadersServerChanged(UnitTester $I)
+    {
+        $I->wantToTest('Http\Request - getHeaders() - server changed');
+
+        $store   = $_SERVER ?? [];
+        $time    = $_SERVER['REQUEST_TIME_FLOAT'];
+        $_SERVER = [
+            'REQUEST_TIME_FLOAT' => $time,
+            'HTTP_FOO'           => 'Bar',
+            'CONTENT_TYPE'       => 'text/html',
+        ];
+
+        $request = new Request();
+
+        $expected = [
+            'Foo'          => 'Bar',
+            'Content-Type' => 'text/html',
+        ];
+
+        $I->assertSame($expected, $request->getHeaders());
+        $I->assertSame($expected, $request->getHeaders());
+        $I->assertSame('Bar', $request->getHeader('foo'));
+        $I->assertSame('Bar', $request->getHeader('FOO'));
+
+        /**
+         * The headers are parsed again after the server array changed
+         */
+        $_SERVER['HTTP_FOO']         = 'Baz';
+        $_SERVER['HTTP_X_REQUESTED'] = 'yes';
+
+        $expected = [
+            'Foo'          => 'Baz',
+            'Content-Type' => 'text/html',
+            'X-Requested'  => 'yes',
+        ];
+
+        $I->assertSame($expected, $request->getHeaders());
+        $I->assertSame('Baz', $request->getHeader('foo'));
+        $I->assertTrue($request->hasHeader('x-requested'));
+
+        $_SERVER = $store;
+    }
 }
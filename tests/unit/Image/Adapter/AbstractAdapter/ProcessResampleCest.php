@@ -0,0 +1,52 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\AbstractAdapter;
+
+use Phalcon\Image\Enum;
+use Phalcon\Tests\Fixtures\Image\Adapter\CropResizeAdapter;
+use UnitTester;
+
+class ProcessResampleCest
+{
+    /**
+     * Tests Phalcon\Image\Adapter\AbstractAdapter :: processResample()
+     *
+     * Adapters implementing only processCrop() and processResize() apply a
+     * fused resize and crop with a crop followed by a resize
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterAbstractAdapterProcessResample(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\AbstractAdapter - processResample()');
+
+        $image = new CropResizeAdapter(400, 200);
+
+        $image->resize(200, 100, Enum::NONE)
+              ->crop(50, 40, 10, 20)
+        ;
+
+        $I->assertSame('image', $image->getImage());
+        $I->assertSame(
+            [
+                ['crop', 100, 80, 20, 40],
+                ['resize', 50, 40],
+            ],
+            $image->calls
+        );
+        $I->assertSame(50, $image->getWidth());
+        $I->assertSame(40, $image->getHeight());
+    }
+}
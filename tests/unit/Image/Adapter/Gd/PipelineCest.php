@@ -0,0 +1,146 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Gd;
+
+use Phalcon\Image\Adapter\Gd;
+use Phalcon\Image\Exception;
+use Phalcon\Tests\Fixtures\Traits\GdTrait;
+use UnitTester;
+
+use function dataDir;
+use function file_get_contents;
+use function file_put_contents;
+use function getimagesize;
+use function imagesx;
+use function imagesy;
+use function outputDir;
+use function restore_error_handler;
+use function set_error_handler;
+use function substr;
+use function unlink;
+
+class PipelineCest
+{
+    use GdTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: resize(), crop() - deferred
+     *
+     * The resize and the crop are applied with a single resample when the
+     * image is saved, and the size is known before the image is decoded
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPipeline(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - resize(), crop() - deferred');
+
+        $this->checkJpegSupport($I);
+
+        $image = new Gd(dataDir('assets/images/example-jpg.jpg'));
+
+        $I->assertSame(1820, $image->getWidth());
+        $I->assertSame(694, $image->getHeight());
+
+        $image->resize(400, 200)
+              ->crop(150, 100, 20, 10)
+        ;
+
+        $I->assertSame(150, $image->getWidth());
+        $I->assertSame(100, $image->getHeight());
+
+        $output = outputDir('tests/image/gd/pipeline.jpg');
+
+        $image->save($output);
+
+        $I->amInPath(outputDir('tests/image/gd/'));
+        $I->seeFileFound('pipeline.jpg');
+
+        $info = getimagesize($output);
+
+        $I->assertSame(150, $info[0]);
+        $I->assertSame(100, $info[1]);
+
+        $I->safeDeleteFile('pipeline.jpg');
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: crop(), resize() - deferred
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPipelineCropResize(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - crop(), resize() - deferred');
+
+        $this->checkJpegSupport($I);
+
+        $image = new Gd(dataDir('assets/images/example-jpg.jpg'));
+
+        $image->crop(600, 600)
+              ->resize(120, 120)
+        ;
+
+        $I->assertSame(120, $image->getWidth());
+        $I->assertSame(120, $image->getHeight());
+
+        $actual = $image->getImage();
+
+        $I->assertSame(120, imagesx($actual));
+        $I->assertSame(120, imagesy($actual));
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: getImage() - undecodable file
+     *
+     * The header of the file is valid, so the failure is reported when the
+     * pixels are decoded
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPipelineUndecodable(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - getImage() - undecodable file');
+
+        $file = outputDir('tests/image/gd/truncated.png');
+        file_put_contents(
+            $file,
+            substr(file_get_contents(dataDir('assets/images/example-png.png')), 0, 64)
+        );
+
+        $image = new Gd($file);
+
+        $I->assertSame(getimagesize($file)[0], $image->getWidth());
+
+        set_error_handler(
+            function () {
+                return true;
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception('Failed to create image from file ' . $file),
+            function () use ($image) {
+                $image->getImage();
+            }
+        );
+
+        restore_error_handler();
+
+        unlink($file);
+    }
+}
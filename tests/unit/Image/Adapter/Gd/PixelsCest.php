@@ -0,0 +1,358 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Gd;
+
+use GdImage;
+use Phalcon\Image\Adapter\Gd;
+use Phalcon\Tests\Fixtures\Traits\GdTrait;
+use UnitTester;
+
+use function abs;
+use function imagealphablending;
+use function imagecolorallocatealpha;
+use function imagecolorat;
+use function imagecopy;
+use function imagecreatefrompng;
+use function imagecreatetruecolor;
+use function imagefilledrectangle;
+use function imagefilter;
+use function imagepng;
+use function imagesavealpha;
+use function imagesx;
+use function imagesy;
+use function outputDir;
+use function round;
+use function unlink;
+
+use const IMG_FILTER_COLORIZE;
+use const IMG_FILTER_GAUSSIAN_BLUR;
+
+class PixelsCest
+{
+    use GdTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: blur() - pixels
+     *
+     * The blur of a sharp edge stays within a few levels of running the
+     * gaussian filter of GD once per radius, away from the borders
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPixelsBlur(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - blur() - pixels');
+
+        $radius = 4;
+        $file   = $this->createImage(
+            24,
+            24,
+            function (GdImage $image) {
+                imagefilledrectangle(
+                    $image,
+                    12,
+                    0,
+                    23,
+                    23,
+                    imagecolorallocatealpha($image, 255, 255, 255, 0)
+                );
+                imagefilledrectangle(
+                    $image,
+                    4,
+                    8,
+                    15,
+                    15,
+                    imagecolorallocatealpha($image, 200, 40, 90, 0)
+                );
+            }
+        );
+
+        $expected = imagecreatefrompng($file);
+        for ($counter = 0; $counter < $radius; $counter++) {
+            imagefilter($expected, IMG_FILTER_GAUSSIAN_BLUR);
+        }
+
+        $image  = new Gd($file);
+        $actual = $image->blur($radius)->getImage();
+
+        for ($y = $radius; $y < 24 - $radius; $y++) {
+            for ($x = $radius; $x < 24 - $radius; $x++) {
+                $this->assertColorNear(
+                    $I,
+                    imagecolorat($expected, $x, $y),
+                    imagecolorat($actual, $x, $y),
+                    6
+                );
+            }
+        }
+
+        $edge = imagecolorat($actual, 12, 2) & 0xFF;
+        $I->assertGreaterThan(0, $edge);
+        $I->assertLessThan(255, $edge);
+
+        unlink($file);
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: pixelate() - pixels
+     *
+     * Blocks of a single color are left as the previous sampling did, and
+     * the others are filled with the average of their colors
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPixelsPixelate(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - pixelate() - pixels');
+
+        $file = $this->createImage(
+            8,
+            8,
+            function (GdImage $image) {
+                $colors = [
+                    [10, 20, 30, 0],
+                    [250, 128, 0, 0],
+                    [0, 255, 64, 0],
+                    [90, 90, 200, 0],
+                ];
+                foreach ($colors as $index => [$red, $green, $blue, $alpha]) {
+                    $x = ($index % 2) * 4;
+                    $y = (int) ($index / 2) * 4;
+                    imagefilledrectangle(
+                        $image,
+                        $x,
+                        $y,
+                        $x + 3,
+                        $y + 3,
+                        imagecolorallocatealpha($image, $red, $green, $blue, $alpha)
+                    );
+                }
+            }
+        );
+
+        $expected = imagecreatefrompng($file);
+        $this->previousPixelate($expected, 4);
+
+        $image = new Gd($file);
+        $this->assertSamePixels($I, $expected, $image->pixelate(4)->getImage());
+
+        unlink($file);
+
+        $file = $this->createImage(
+            4,
+            4,
+            function (GdImage $image) {
+                imagefilledrectangle(
+                    $image,
+                    2,
+                    0,
+                    3,
+                    3,
+                    imagecolorallocatealpha($image, 255, 255, 255, 0)
+                );
+            }
+        );
+
+        $image  = new Gd($file);
+        $actual = $image->pixelate(4)->getImage();
+
+        for ($y = 0; $y < 4; $y++) {
+            for ($x = 0; $x < 4; $x++) {
+                $I->assertSame(0x808080, imagecolorat($actual, $x, $y));
+            }
+        }
+
+        unlink($file);
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: reflection() - pixels
+     *
+     * The reflection is the one of copying and colorizing every row
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdPixelsReflection(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - reflection() - pixels');
+
+        $file = $this->createImage(
+            6,
+            4,
+            function (GdImage $image) {
+                for ($y = 0; $y < 4; $y++) {
+                    for ($x = 0; $x < 6; $x++) {
+                        imagefilledrectangle(
+                            $image,
+                            $x,
+                            $y,
+                            $x,
+                            $y,
+                            imagecolorallocatealpha(
+                                $image,
+                                $x * 40,
+                                $y * 60,
+                                255 - $x * 30,
+                                $x * $y * 6
+                            )
+                        );
+                    }
+                }
+            }
+        );
+
+        foreach ([[3, 50, false], [3, 50, true], [4, 0, false], [2, 100, true]] as [$height, $opacity, $fadeIn]) {
+            $expected = $this->previousReflection(
+                imagecreatefrompng($file),
+                $height,
+                $opacity,
+                $fadeIn
+            );
+
+            $image = new Gd($file);
+            $this->assertSamePixels(
+                $I,
+                $expected,
+                $image->reflection($height, $opacity, $fadeIn)->getImage()
+            );
+        }
+
+        unlink($file);
+    }
+
+    /**
+     * Asserts that every channel of two colors differs by at most the
+     * tolerance
+     */
+    private function assertColorNear(
+        UnitTester $I,
+        int $expected,
+        int $actual,
+        int $tolerance
+    ): void {
+        foreach ([24, 16, 8, 0] as $shift) {
+            $I->assertLessThanOrEqual(
+                $tolerance,
+                abs((($expected >> $shift) & 0xFF) - (($actual >> $shift) & 0xFF))
+            );
+        }
+    }
+
+    /**
+     * Asserts that two images have the same size and pixels
+     */
+    private function assertSamePixels(
+        UnitTester $I,
+        GdImage $expected,
+        GdImage $actual
+    ): void {
+        $I->assertSame(imagesx($expected), imagesx($actual));
+        $I->assertSame(imagesy($expected), imagesy($actual));
+
+        for ($y = 0; $y < imagesy($expected); $y++) {
+            for ($x = 0; $x < imagesx($expected); $x++) {
+                $I->assertSame(
+                    imagecolorat($expected, $x, $y),
+                    imagecolorat($actual, $x, $y)
+                );
+            }
+        }
+    }
+
+    /**
+     * Saves a black truecolor PNG drawn by the callback
+     */
+    private function createImage(int $width, int $height, callable $draw): string
+    {
+        $image = imagecreatetruecolor($width, $height);
+        imagealphablending($image, false);
+        imagesavealpha($image, true);
+
+        $draw($image);
+
+        $file = outputDir('tests/image/gd/pixels.png');
+        imagepng($image, $file);
+
+        return $file;
+    }
+
+    /**
+     * The pixelate of the adapter before the native kernel
+     */
+    private function previousPixelate(GdImage $image, int $amount): void
+    {
+        for ($x = 0; $x < imagesx($image); $x += $amount) {
+            for ($y = 0; $y < imagesy($image); $y += $amount) {
+                $x1 = (int) ($x + ($amount / 2));
+                $y1 = (int) ($y + ($amount / 2));
+
+                if ($x1 >= imagesx($image) || $y1 >= imagesy($image)) {
+                    break;
+                }
+
+                imagefilledrectangle(
+                    $image,
+                    $x,
+                    $y,
+                    $x + $amount,
+                    $y + $amount,
+                    imagecolorat($image, $x1, $y1)
+                );
+            }
+        }
+    }
+
+    /**
+     * The reflection of the adapter before the native kernel
+     */
+    private function previousReflection(
+        GdImage $image,
+        int $height,
+        int $opacity,
+        bool $fadeIn
+    ): GdImage {
+        $width       = imagesx($image);
+        $imageHeight = imagesy($image);
+        $opacity     = (int) round(abs(($opacity * 127 / 100) - 127));
+        $stepping    = (int) ($opacity < 127 ? (127 - $opacity) / $height : 127 / $height);
+
+        $reflection = imagecreatetruecolor($width, $imageHeight + $height);
+        imagealphablending($reflection, false);
+        imagesavealpha($reflection, true);
+        imagecopy($reflection, $image, 0, 0, 0, 0, $width, $imageHeight);
+
+        for ($offset = 0; $offset <= $height; $offset++) {
+            $line = imagecreatetruecolor($width, 1);
+            imagealphablending($line, false);
+            imagesavealpha($line, true);
+            imagecopy($line, $image, 0, 0, 0, $imageHeight - $offset - 1, $width, 1);
+
+            imagefilter(
+                $line,
+                IMG_FILTER_COLORIZE,
+                0,
+                0,
+                0,
+                $opacity + $stepping * ($fadeIn ? $height - $offset : $offset)
+            );
+
+            imagecopy($reflection, $line, 0, $imageHeight + $offset, 0, 0, $width, 1);
+        }
+
+        return $reflection;
+    }
+}
@@ -0,0 +1,104 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Gd;
+
+use Phalcon\Image\Adapter\Gd;
+use Phalcon\Tests\Fixtures\Traits\GdTrait;
+use UnitTester;
+
+use function codecept_debug;
+use function hrtime;
+use function imagefilter;
+use function implode;
+use function sprintf;
+
+use const IMG_FILTER_GAUSSIAN_BLUR;
+
+class ThroughputCest
+{
+    use GdTrait;
+
+    /**
+     * Radius of the blur measured by the benchmark
+     */
+    private const RADIUS = 10;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: blur(), pixelate(), reflection() -
+     * throughput
+     *
+     * Blurs, pixelates and reflects the fixture images and reports the time
+     * of each operation. The blur is compared with running the gaussian
+     * filter of GD once per radius, as the adapter did. Run with --debug to
+     * see the figures.
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterGdThroughput(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - blur(), pixelate(), reflection() - throughput');
+
+        foreach ($this->getImages() as $label => $imagePath) {
+            $figures = [];
+
+            foreach (['blur', 'pixelate', 'reflection', 'previous blur'] as $operation) {
+                $image = new Gd($imagePath);
+
+                /**
+                 * The decoding is not measured
+                 */
+                $image->getImage();
+
+                $width  = $image->getWidth();
+                $height = $image->getHeight();
+
+                $start = hrtime(true);
+                switch ($operation) {
+                    case 'blur':
+                        $image->blur(self::RADIUS);
+                        break;
+                    case 'pixelate':
+                        $image->pixelate(10);
+                        break;
+                    case 'reflection':
+                        $image->reflection((int) ($height / 2), 50, true);
+                        break;
+                    default:
+                        for ($counter = 0; $counter < self::RADIUS; $counter++) {
+                            imagefilter($image->getImage(), IMG_FILTER_GAUSSIAN_BLUR);
+                        }
+                        break;
+                }
+                $figures[] = sprintf(
+                    '%s %.2f ms',
+                    $operation,
+                    (hrtime(true) - $start) / 1e6
+                );
+            }
+
+            $I->assertNotEmpty($figures);
+
+            codecept_debug(
+                sprintf(
+                    '%s (%dx%d): %s',
+                    $label,
+                    $width,
+                    $height,
+                    implode(', ', $figures)
+                )
+            );
+        }
+    }
+}
@@ -0,0 +1,106 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Imagick;
+
+use Imagick as ImagickImage;
+use Phalcon\Image\Adapter\Imagick;
+use Phalcon\Image\Enum;
+use Phalcon\Tests\Fixtures\Traits\ImagickTrait;
+use UnitTester;
+
+use function dataDir;
+use function getimagesize;
+use function outputDir;
+
+class PipelineCest
+{
+    use ImagickTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Imagick :: resize(), crop() - deferred
+     *
+     * The image is read with the size of the thumbnail as a JPEG decoding
+     * hint, and the resize and the crop are applied with a single resample
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterImagickPipeline(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Imagick - resize(), crop() - deferred');
+
+        $image = new Imagick(
+            dataDir('assets/images/example-jpg.jpg')
+        );
+
+        $I->assertSame(1820, $image->getWidth());
+        $I->assertSame(694, $image->getHeight());
+
+        $image->resize(200, 200)
+              ->crop(100, 50)
+        ;
+
+        $I->assertSame(100, $image->getWidth());
+        $I->assertSame(50, $image->getHeight());
+
+        $output = outputDir('tests/image/imagick/pipeline.jpg');
+
+        $image->save($output);
+
+        $I->amInPath(outputDir('tests/image/imagick/'));
+        $I->seeFileFound('pipeline.jpg');
+
+        $info = getimagesize($output);
+
+        $I->assertSame(100, $info[0]);
+        $I->assertSame(50, $info[1]);
+
+        $I->assertSame(100, $image->getImage()->getImageWidth());
+        $I->assertSame(50, $image->getImage()->getImageHeight());
+
+        $I->safeDeleteFile('pipeline.jpg');
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Imagick :: resize() - full decode
+     *
+     * A single resize is applied to the image decoded at its full size, as
+     * when the constructor read the pixels
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function imageAdapterImagickPipelineResize(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Imagick - resize() - full decode');
+
+        $source = dataDir('assets/images/example-jpg.jpg');
+
+        $expected = new ImagickImage($source);
+        $expected->setImageAlphaChannel(ImagickImage::ALPHACHANNEL_SET);
+        $expected->scaleImage(200, 100);
+
+        $image = new Imagick($source);
+        $image->resize(200, 100, Enum::NONE);
+
+        $actual = $image->getImage();
+
+        $I->assertSame(200, $actual->getImageWidth());
+        $I->assertSame(100, $actual->getImageHeight());
+        $I->assertSame(
+            $expected->getImageSignature(),
+            $actual->getImageSignature()
+        );
+    }
+}
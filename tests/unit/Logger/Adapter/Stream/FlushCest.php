@@ -0,0 +1,154 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Logger\Adapter\Stream;
+
+use DateTimeImmutable;
+use Phalcon\Logger\Adapter\Stream;
+use Phalcon\Logger\Enum;
+use Phalcon\Logger\Item;
+use UnitTester;
+
+use function file_get_contents;
+use function logsDir;
+use function substr_count;
+
+class FlushCest
+{
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush() - bufferLines
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function loggerAdapterStreamFlushBufferLines(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush() - bufferLines');
+
+        $fileName = logsDir($I->getNewFileName('log', 'log'));
+        $adapter  = new Stream($fileName, ['bufferLines' => 3]);
+
+        $adapter->process($this->newItem('Message 1'));
+        $adapter->process($this->newItem('Message 2'));
+
+        $I->assertFileDoesNotExist($fileName);
+        $I->assertSame(2, substr_count($adapter->getBuffer(), 'Message'));
+
+        /**
+         * The third line reaches the threshold
+         */
+        $adapter->process($this->newItem('Message 3'));
+
+        $I->assertSame('', $adapter->getBuffer());
+        $I->assertSame(3, substr_count(file_get_contents($fileName), 'Message'));
+
+        $adapter->process($this->newItem('Message 4'));
+        $adapter->flush();
+
+        $I->assertSame('', $adapter->getBuffer());
+        $I->assertStringContainsString('Message 4', file_get_contents($fileName));
+
+        $adapter->close();
+        $I->safeDeleteFile($fileName);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush() - bufferSize
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function loggerAdapterStreamFlushBufferSize(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush() - bufferSize');
+
+        $fileName = logsDir($I->getNewFileName('log', 'log'));
+        $adapter  = new Stream($fileName, ['bufferSize' => 1024]);
+
+        for ($counter = 1; $counter <= 5; $counter++) {
+            $adapter->process($this->newItem('Message ' . $counter));
+        }
+
+        $I->assertFileDoesNotExist($fileName);
+
+        /**
+         * Closing the adapter writes the remaining lines
+         */
+        $adapter->close();
+
+        $I->assertSame(5, substr_count(file_get_contents($fileName), 'Message'));
+
+        $adapter->process($this->newItem('Message 6'));
+
+        /**
+         * So does destroying it
+         */
+        unset($adapter);
+
+        $I->assertStringContainsString('Message 6', file_get_contents($fileName));
+        $I->safeDeleteFile($fileName);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush() - transaction
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function loggerAdapterStreamFlushTransaction(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush() - transaction');
+
+        $fileName = logsDir($I->getNewFileName('log', 'log'));
+        $adapter  = new Stream($fileName, ['bufferLines' => 10]);
+
+        $adapter->begin();
+        $adapter->add($this->newItem('Message 1'));
+        $adapter->add($this->newItem('Message 2'));
+        $adapter->commit();
+
+        /**
+         * The committed lines join the buffer
+         */
+        $I->assertFileDoesNotExist($fileName);
+        $I->assertSame(2, substr_count($adapter->getBuffer(), 'Message'));
+
+        $adapter->close();
+
+        /**
+         * Without buffering the queue is written at commit
+         */
+        $adapter = new Stream($fileName);
+
+        $adapter->begin();
+        $adapter->add($this->newItem('Message 3'));
+        $adapter->add($this->newItem('Message 4'));
+        $adapter->commit();
+
+        $I->assertSame('', $adapter->getBuffer());
+        $I->assertSame(4, substr_count(file_get_contents($fileName), 'Message'));
+
+        $adapter->close();
+        $I->safeDeleteFile($fileName);
+    }
+
+    private function newItem(string $message): Item
+    {
+        return new Item(
+            $message,
+            'debug',
+            Enum::DEBUG,
+            new DateTimeImmutable('now')
+        );
+    }
+}
@@ -0,0 +1,110 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Support\Helper\File;
+
+use Phalcon\Support\Helper\File\MergeExported;
+use UnitTester;
+
+use function array_merge;
+use function clearstatcache;
+use function fileinode;
+use function outputDir;
+use function restore_error_handler;
+use function set_error_handler;
+use function unlink;
+
+class MergeExportedCest
+{
+    /**
+     * Tests Phalcon\Support\Helper\File :: mergeExported()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function supportHelperFileMergeExported(UnitTester $I)
+    {
+        $I->wantToTest('Support\Helper\File - mergeExported()');
+
+        $object = new MergeExported();
+        $file   = outputDir('tests/merge-exported.php');
+
+        $actual = $object(
+            $file,
+            function (array $current) {
+                return array_merge($current, ['one' => 1]);
+            }
+        );
+        $I->assertSame(['one' => 1], $actual);
+        $I->assertSame(['one' => 1], require $file);
+
+        $actual = $object(
+            $file,
+            function (array $current) {
+                return array_merge($current, ['two' => 2]);
+            }
+        );
+        $I->assertSame(['one' => 1, 'two' => 2], $actual);
+        $I->assertSame(['one' => 1, 'two' => 2], require $file);
+
+        /**
+         * Unchanged contents do not replace the file
+         */
+        clearstatcache();
+        $inode = fileinode($file);
+
+        $actual = $object(
+            $file,
+            function (array $current) {
+                return $current;
+            }
+        );
+        $I->assertSame(['one' => 1, 'two' => 2], $actual);
+
+        clearstatcache();
+        $I->assertSame($inode, fileinode($file));
+
+        unlink($file);
+        unlink($file . '.lock');
+    }
+
+    /**
+     * Tests Phalcon\Support\Helper\File :: mergeExported() - not writable
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2026-10-15
+     */
+    public function supportHelperFileMergeExportedNotWritable(UnitTester $I)
+    {
+        $I->wantToTest('Support\Helper\File - mergeExported() - not writable');
+
+        $object = new MergeExported();
+
+        set_error_handler(
+            function () {
+                return true;
+            }
+        );
+
+        $actual = $object(
+            outputDir('tests/unknown/merge-exported.php'),
+            function (array $current) {
+                return $current;
+            }
+        );
+
+        restore_error_handler();
+
+        $I->assertFalse($actual);
+    }
+}
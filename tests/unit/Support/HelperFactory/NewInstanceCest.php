@@ -38,6 +38,7 @@ use Phalcon\Support\Helper\Arr\ValidateAll;
 use Phalcon\Support\Helper\Arr\ValidateAny;
 use Phalcon\Support\Helper\Arr\Whitelist;
 use Phalcon\Support\Helper\File\Basename;
+use Phalcon\Support\Helper\File\MergeExported;
 use Phalcon\Support\Helper\Json\Decode;
 use Phalcon\Support\Helper\Json\Encode;
 use Phalcon\Support\Helper\Number\IsBetween;
@@ -153,6 +154,7 @@ class NewInstanceCest
             ["validateAny", ValidateAny::class],
             ["whitelist", Whitelist::class],
             ["basename", Basename::class],
+            ["mergeExported", MergeExported::class],
             ["decode", Decode::class],
             ["encode", Encode::class],
             ["isBetween", IsBetween::class],